@@ -0,0 +1,379 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <rttr/type>
+
+#include <nanobench.h>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <iostream>
+#include <list>
+#include <map>
+#include <new>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static std::atomic<std::size_t> g_allocation_count{0};
+
+void* operator new(std::size_t size)
+{
+    g_allocation_count.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size ? size : 1))
+        return ptr;
+
+    throw std::bad_alloc();
+}
+
+// gcc does not see, that the replaced operator new allocates with malloc
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    ::operator delete(ptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static const std::size_t element_count = 1000;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Iterates once over all items of the view and returns the number of heap allocations,
+ * which were done on the way.
+ */
+template<typename View, typename Func>
+static std::size_t count_allocations(const View& view, const Func& func)
+{
+    const auto start = g_allocation_count.load(std::memory_order_relaxed);
+    for (auto itr = view.begin(); itr != view.end(); ++itr)
+        func(itr);
+
+    return (g_allocation_count.load(std::memory_order_relaxed) - start);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+static void bench_sequential_view(const char* title, T container)
+{
+    rttr::variant var = std::ref(container);
+    const auto view = var.create_sequential_view();
+    volatile std::size_t value = 0;
+    const auto visit = [&](const rttr::variant_sequential_view::const_iterator& itr)
+    {
+        if (itr.get_data().is_valid())
+            value = value + 1;
+    };
+
+    count_allocations(view, visit); // warm up
+    const auto allocations = count_allocations(view, visit);
+
+    ankerl::nanobench::Bench().minEpochIterations(10).run(std::string("iterate sequential view ") + title, [&]() {
+        for (auto itr = view.begin(); itr != view.end(); ++itr)
+            visit(itr);
+        ankerl::nanobench::doNotOptimizeAway(static_cast<std::size_t>(value));
+    });
+
+    std::cout << "  allocations per iteration: " << allocations
+              << " (" << view.get_size() << " items)" << std::endl;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+static void bench_associative_view(const char* title, T container)
+{
+    rttr::variant var = std::ref(container);
+    const auto view = var.create_associative_view();
+    volatile std::size_t value = 0;
+    const auto visit = [&](const rttr::variant_associative_view::const_iterator& itr)
+    {
+        if (itr.get_key().is_valid() && itr.get_value().is_valid())
+            value = value + 1;
+    };
+
+    count_allocations(view, visit); // warm up
+    const auto allocations = count_allocations(view, visit);
+
+    ankerl::nanobench::Bench().minEpochIterations(10).run(std::string("iterate associative view ") + title, [&]() {
+        for (auto itr = view.begin(); itr != view.end(); ++itr)
+            visit(itr);
+        ankerl::nanobench::doNotOptimizeAway(static_cast<std::size_t>(value));
+    });
+
+    std::cout << "  allocations per iteration: " << allocations
+              << " (" << view.get_size() << " items)" << std::endl;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static void bench_sum_floats_per_element(const std::vector<float>& container)
+{
+    rttr::variant var = std::cref(container);
+    const auto view = var.create_sequential_view();
+
+    ankerl::nanobench::Bench().minEpochIterations(10).run("sum std::vector<float> per element", [&]() {
+        float sum = 0.0f;
+        for (const auto& item : view)
+            sum += item.get_wrapped_value<float>();
+        ankerl::nanobench::doNotOptimizeAway(sum);
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static void bench_sum_floats_contiguous(const std::vector<float>& container)
+{
+    rttr::variant var = std::cref(container);
+    const auto view = var.create_sequential_view();
+
+    ankerl::nanobench::Bench().minEpochIterations(10).run("sum std::vector<float> contiguous data", [&]() {
+        float sum = 0.0f;
+        for (const float value : view.get_contiguous_data().get_span<const float>())
+            sum += value;
+        ankerl::nanobench::doNotOptimizeAway(sum);
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+static T make_sequential()
+{
+    T container;
+    for (std::size_t i = 0; i < element_count; ++i)
+        container.push_back(static_cast<typename T::value_type>(i));
+
+    return container;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+static T make_associative()
+{
+    T container;
+    for (std::size_t i = 0; i < element_count; ++i)
+        container.emplace(static_cast<int>(i), static_cast<int>(i));
+
+    return container;
+}
+
+/*!
+ * The conversion, which was necessary before variant_sequential_view::convert() was introduced:
+ * every element is converted separately through a variant.
+ */
+template<typename F, typename T>
+static void bench_convert_per_element(const char* title)
+{
+    const auto source = make_sequential<std::vector<F>>();
+    std::vector<T> target;
+    rttr::variant var_source = std::cref(source);
+    rttr::variant var_target = std::ref(target);
+    const auto source_view = var_source.create_sequential_view();
+    auto target_view = var_target.create_sequential_view();
+    const auto target_type = target_view.get_value_type();
+
+    ankerl::nanobench::Bench().minEpochIterations(10).run(std::string("convert per element ") + title, [&]() {
+        target_view.set_size(source_view.get_size());
+        std::size_t index = 0;
+        for (const auto& item : source_view)
+        {
+            rttr::variant value = item.extract_wrapped_value();
+            value.convert(target_type);
+            target_view.set_value(index++, value);
+        }
+        ankerl::nanobench::doNotOptimizeAway(target.data());
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename F, typename T>
+static void bench_convert_bulk(const char* title)
+{
+    const auto source = make_sequential<std::vector<F>>();
+    std::vector<T> target;
+    rttr::variant var_source = std::cref(source);
+    rttr::variant var_target = std::ref(target);
+    const auto source_view = var_source.create_sequential_view();
+    const auto target_view = var_target.create_sequential_view();
+
+    ankerl::nanobench::Bench().minEpochIterations(10).run(std::string("convert bulk ") + title, [&]() {
+        if (!source_view.convert(target_view))
+            std::cout << "conversion failed" << std::endl;
+        ankerl::nanobench::doNotOptimizeAway(target.data());
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static const std::size_t fill_element_count = 100000;
+
+static std::vector<int> make_fill_data()
+{
+    std::vector<int> data(fill_element_count);
+    for (std::size_t i = 0; i < fill_element_count; ++i)
+        data[i] = static_cast<int>(i);
+
+    return data;
+}
+
+/*!
+ * Filling a container one element at a time through the view;
+ * this was the only way (e.g. for a deserializer) before the batched insert functions were introduced.
+ */
+template<typename T>
+static void bench_fill_sequential_per_element(const char* title, const std::vector<int>& data)
+{
+    ankerl::nanobench::Bench().minEpochIterations(5).run(std::string("insert per element ") + title, [&]() {
+        T target;
+        rttr::variant var = std::ref(target);
+        auto view = var.create_sequential_view();
+        for (const auto value : data)
+            view.insert(view.end(), value);
+        ankerl::nanobench::doNotOptimizeAway(target);
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+static void bench_fill_sequential_batched(const char* title, const std::vector<int>& data)
+{
+    rttr::variant var_data = std::cref(data);
+    const auto data_view = var_data.create_sequential_view();
+
+    ankerl::nanobench::Bench().minEpochIterations(5).run(std::string("insert batched ") + title, [&]() {
+        T target;
+        rttr::variant var = std::ref(target);
+        auto view = var.create_sequential_view();
+        view.insert(view.end(), data_view);
+        ankerl::nanobench::doNotOptimizeAway(target);
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+static void bench_fill_associative_per_element(const char* title, const std::vector<int>& data)
+{
+    ankerl::nanobench::Bench().minEpochIterations(5).run(std::string("insert per element ") + title, [&]() {
+        T target;
+        rttr::variant var = std::ref(target);
+        auto view = var.create_associative_view();
+        for (const auto value : data)
+            view.insert(value, value);
+        ankerl::nanobench::doNotOptimizeAway(target);
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+static void bench_fill_associative_batched(const char* title, const std::vector<int>& data)
+{
+    rttr::variant var_data = std::cref(data);
+    const auto data_view = var_data.create_sequential_view();
+
+    ankerl::nanobench::Bench().minEpochIterations(5).run(std::string("insert batched ") + title, [&]() {
+        T target;
+        rttr::variant var = std::ref(target);
+        auto view = var.create_associative_view();
+        view.insert(data_view, data_view);
+        ankerl::nanobench::doNotOptimizeAway(target);
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_container_view()
+{
+    std::cout << "=== Container View Benchmark ===" << std::endl;
+    std::cout << "Iterating containers with " << element_count << " items through the sequential and associative view, "
+              << "the heap allocations of one full iteration are counted..." << std::endl << std::endl;
+
+    std::cout << "[Group: sequential view]" << std::endl;
+    bench_sequential_view("std::vector<int>", make_sequential<std::vector<int>>());
+    bench_sequential_view("std::deque<int>", make_sequential<std::deque<int>>());
+    bench_sequential_view("std::list<int>", make_sequential<std::list<int>>());
+    std::cout << std::endl;
+
+    std::cout << "[Group: contiguous data]" << std::endl;
+    const auto floats = make_sequential<std::vector<float>>();
+    bench_sum_floats_per_element(floats);
+    bench_sum_floats_contiguous(floats);
+    std::cout << std::endl;
+
+    std::cout << "[Group: convert]" << std::endl;
+    bench_convert_per_element<int32_t, double>("std::vector<int32_t> to std::vector<double>");
+    bench_convert_bulk<int32_t, double>("std::vector<int32_t> to std::vector<double>");
+    bench_convert_per_element<int64_t, int16_t>("std::vector<int64_t> to std::vector<int16_t>");
+    bench_convert_bulk<int64_t, int16_t>("std::vector<int64_t> to std::vector<int16_t>");
+    bench_convert_per_element<double, float>("std::vector<double> to std::vector<float>");
+    bench_convert_bulk<double, float>("std::vector<double> to std::vector<float>");
+    std::cout << std::endl;
+
+    std::cout << "[Group: associative view]" << std::endl;
+    bench_associative_view("std::map<int, int>", make_associative<std::map<int, int>>());
+    bench_associative_view("std::unordered_map<int, int>", make_associative<std::unordered_map<int, int>>());
+    std::cout << std::endl;
+
+    std::cout << "[Group: fill container with " << fill_element_count << " items]" << std::endl;
+    const auto fill_data = make_fill_data();
+    bench_fill_sequential_per_element<std::vector<int>>("std::vector<int>", fill_data);
+    bench_fill_sequential_batched<std::vector<int>>("std::vector<int>", fill_data);
+    bench_fill_sequential_per_element<std::deque<int>>("std::deque<int>", fill_data);
+    bench_fill_sequential_batched<std::deque<int>>("std::deque<int>", fill_data);
+    bench_fill_associative_per_element<std::unordered_map<int, int>>("std::unordered_map<int, int>", fill_data);
+    bench_fill_associative_batched<std::unordered_map<int, int>>("std::unordered_map<int, int>", fill_data);
+    std::cout << std::endl;
+
+    std::cout << "=== Benchmark Complete ===" << std::endl;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
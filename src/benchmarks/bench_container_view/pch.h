@@ -0,0 +1,13 @@
+// std stuff
+#include <atomic>
+#include <deque>
+#include <list>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <iostream>
+
+#include <rttr/type>
+
+#include <nanobench.h>
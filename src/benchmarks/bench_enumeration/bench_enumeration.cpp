@@ -0,0 +1,139 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <rttr/registration>
+
+#include <nanobench.h>
+
+#include <array>
+#include <iostream>
+#include <string>
+#include <utility>
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static constexpr std::size_t enum_value_count = 256;
+
+// values 0, 1, 2, ... are stored in a dense table
+enum class dense_code : int {};
+
+// values 0, 7919, 15838, ... are stored in a sorted list
+enum class sparse_code : int {};
+
+static const std::array<std::string, enum_value_count>& get_enum_names()
+{
+    static const auto names = []()
+    {
+        std::array<std::string, enum_value_count> result;
+        for (std::size_t i = 0; i < enum_value_count; ++i)
+            result[i] = "code_" + std::to_string(i);
+        return result;
+    }();
+
+    return names;
+}
+
+template<typename Enum_Type, std::size_t... I>
+static void register_enumeration(const char* name, int stride, std::index_sequence<I...>)
+{
+    const auto& names = get_enum_names();
+    rttr::registration::enumeration<Enum_Type>(name)
+    (
+        rttr::value(names[I], static_cast<Enum_Type>(static_cast<int>(I) * stride))...
+    );
+}
+
+RTTR_REGISTRATION
+{
+    register_enumeration<dense_code>("dense_code", 1, std::make_index_sequence<enum_value_count>());
+    register_enumeration<sparse_code>("sparse_code", 7919, std::make_index_sequence<enum_value_count>());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Enum_Type>
+static void bench_enumeration_lookup(const std::string& group, int stride)
+{
+    const rttr::enumeration e = rttr::type::get<Enum_Type>().get_enumeration();
+    const std::string first_name = get_enum_names().front();
+    const std::string last_name = get_enum_names().back();
+    const Enum_Type first_value = static_cast<Enum_Type>(0);
+    const Enum_Type last_value = static_cast<Enum_Type>(static_cast<int>(enum_value_count - 1) * stride);
+
+    std::cout << "[Group: " << group << "]" << std::endl;
+
+    ankerl::nanobench::Bench().run("enumeration name_to_value (first)", [&]() {
+        rttr::variant value = e.name_to_value(first_name);
+        ankerl::nanobench::doNotOptimizeAway(value);
+    });
+
+    ankerl::nanobench::Bench().run("enumeration name_to_value (last)", [&]() {
+        rttr::variant value = e.name_to_value(last_name);
+        ankerl::nanobench::doNotOptimizeAway(value);
+    });
+
+    ankerl::nanobench::Bench().run("enumeration value_to_name (first)", [&]() {
+        rttr::string_view name = e.value_to_name(first_value);
+        ankerl::nanobench::doNotOptimizeAway(name);
+    });
+
+    ankerl::nanobench::Bench().run("enumeration value_to_name (last)", [&]() {
+        rttr::string_view name = e.value_to_name(last_value);
+        ankerl::nanobench::doNotOptimizeAway(name);
+    });
+
+    rttr::variant enum_var = last_value;
+    ankerl::nanobench::Bench().run("variant enum to string", [&]() {
+        std::string text = enum_var.to_string();
+        ankerl::nanobench::doNotOptimizeAway(text);
+    });
+
+    rttr::variant string_var = last_name;
+    ankerl::nanobench::Bench().run("variant string to enum", [&]() {
+        bool ok = false;
+        Enum_Type value = string_var.convert<Enum_Type>(&ok);
+        ankerl::nanobench::doNotOptimizeAway(value);
+    });
+
+    std::cout << std::endl;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_enumeration()
+{
+    std::cout << "\n=== RTTR Enumeration Benchmarks (" << enum_value_count << " values) ===\n" << std::endl;
+
+    bench_enumeration_lookup<dense_code>("contiguous values", 1);
+    bench_enumeration_lookup<sparse_code>("sparse values", 7919);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,140 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "test_classes.h"
+
+#include "to_json.h"
+#include "from_json.h"
+#include "to_binary.h"
+#include "from_binary.h"
+
+#include <nanobench.h>
+
+#include <iostream>
+#include <string>
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static void bench_binary_scene(std::size_t node_count)
+{
+    const scene source = create_scene(node_count);
+    const std::string json_text = io::to_json(source);
+    const std::string binary_data = io::to_binary(source);
+
+    std::cout << "[Group: scene with " << node_count << " nodes, " << json_text.size() << " bytes of json, "
+              << binary_data.size() << " bytes of binary data]" << std::endl;
+
+    ankerl::nanobench::Bench write_bench;
+    write_bench.minEpochIterations(3).relative(true).unit("byte");
+
+    write_bench.batch(json_text.size()).run("to_json", [&]() {
+        std::string text = io::to_json(source);
+        ankerl::nanobench::doNotOptimizeAway(text);
+    });
+
+    write_bench.batch(binary_data.size()).run("to_binary", [&]() {
+        std::string data = io::to_binary(source);
+        ankerl::nanobench::doNotOptimizeAway(data);
+    });
+
+    ankerl::nanobench::Bench read_bench;
+    read_bench.minEpochIterations(3).relative(true).unit("byte");
+
+    read_bench.batch(json_text.size()).run("from_json", [&]() {
+        scene target;
+        io::from_json(json_text, target);
+        ankerl::nanobench::doNotOptimizeAway(target);
+    });
+
+    read_bench.batch(binary_data.size()).run("from_binary", [&]() {
+        scene target;
+        io::from_binary(binary_data, target);
+        ankerl::nanobench::doNotOptimizeAway(target);
+    });
+
+    std::cout << std::endl;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static void bench_versioned_scene(std::size_t node_count)
+{
+    const scene source = create_scene(node_count);
+    const std::string compact_data = io::to_binary(source);
+    const std::string versioned_data = io::to_binary(source, io::binary_format::versioned);
+    const scene_v2 source_v2 = create_scene_v2(node_count);
+    const std::string versioned_data_v2 = io::to_binary(source_v2, io::binary_format::versioned);
+
+    std::cout << "[Group: versioned scene with " << node_count << " nodes, " << compact_data.size() << " bytes compact, "
+              << versioned_data.size() << " bytes versioned, " << versioned_data_v2.size() << " bytes versioned with new properties]" << std::endl;
+
+    ankerl::nanobench::Bench read_bench;
+    read_bench.minEpochIterations(3).relative(true);
+
+    read_bench.run("from_binary - compact", [&]() {
+        scene target;
+        io::from_binary(compact_data, target);
+        ankerl::nanobench::doNotOptimizeAway(target);
+    });
+
+    read_bench.run("from_binary - versioned", [&]() {
+        scene target;
+        io::from_binary(versioned_data, target);
+        ankerl::nanobench::doNotOptimizeAway(target);
+    });
+
+    // every node contains as many unknown properties as known ones
+    read_bench.run("from_binary - versioned, 50% unknown properties", [&]() {
+        scene target;
+        io::from_binary(versioned_data_v2, target);
+        ankerl::nanobench::doNotOptimizeAway(target);
+    });
+
+    std::cout << std::endl;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_binary_serialization()
+{
+    std::cout << "=== Binary Serialization Benchmark ===" << std::endl;
+    std::cout << "Comparing the binary format with the json serialization..." << std::endl << std::endl;
+
+    bench_binary_scene(100);
+    bench_binary_scene(5000);
+
+    bench_versioned_scene(100);
+    bench_versioned_scene(5000);
+
+    std::cout << "=== Benchmark Complete ===" << std::endl;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
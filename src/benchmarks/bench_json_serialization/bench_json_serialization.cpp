@@ -0,0 +1,92 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "test_classes.h"
+
+#include "to_json.h"
+#include "from_json.h"
+
+#include <nanobench.h>
+
+#include <iostream>
+#include <sstream>
+#include <string>
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static void bench_json_scene(std::size_t node_count)
+{
+    const scene source = create_scene(node_count);
+    const std::string json_text = io::to_json(source);
+
+    std::cout << "[Group: scene with " << node_count << " nodes, " << json_text.size() << " bytes of json]" << std::endl;
+
+    ankerl::nanobench::Bench().minEpochIterations(3).run("to_json", [&]() {
+        std::string text = io::to_json(source);
+        ankerl::nanobench::doNotOptimizeAway(text);
+    });
+
+    ankerl::nanobench::Bench().minEpochIterations(3).run("from_json", [&]() {
+        scene target;
+        io::from_json(json_text, target);
+        ankerl::nanobench::doNotOptimizeAway(target);
+    });
+
+    ankerl::nanobench::Bench().minEpochIterations(3).run("to_json - stream", [&]() {
+        std::ostringstream out;
+        io::to_json(source, out);
+        ankerl::nanobench::doNotOptimizeAway(out);
+    });
+
+    ankerl::nanobench::Bench().minEpochIterations(3).run("from_json - stream", [&]() {
+        std::istringstream in(json_text);
+        scene target;
+        io::from_json(in, target);
+        ankerl::nanobench::doNotOptimizeAway(target);
+    });
+
+    std::cout << std::endl;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_json_serialization()
+{
+    std::cout << "=== JSON Serialization Benchmark ===" << std::endl;
+    std::cout << "Running benchmarks for the json serialization example with a large object graph..." << std::endl << std::endl;
+
+    bench_json_scene(100);
+    bench_json_scene(5000);
+
+    std::cout << "=== Benchmark Complete ===" << std::endl;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,10 @@
+// std stuff
+#include <map>
+#include <string>
+#include <vector>
+#include <iostream>
+
+#include <rttr/type>
+
+#include <nanobench.h>
+#include <nlohmann/json.hpp>
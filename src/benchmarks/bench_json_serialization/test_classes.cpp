@@ -0,0 +1,167 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "test_classes.h"
+
+#include <rttr/registration>
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_REGISTRATION
+{
+    using namespace rttr;
+
+    registration::enumeration<node_state>("node_state")
+        (
+            value("idle",       node_state::idle),
+            value("active",     node_state::active),
+            value("disabled",   node_state::disabled)
+        );
+
+    registration::class_<vector3>("vector3")
+        .constructor()(policy::ctor::as_object)
+        .property("x", &vector3::x)
+        .property("y", &vector3::y)
+        .property("z", &vector3::z)
+        ;
+
+    registration::class_<scene_node>("scene_node")
+        .constructor()(policy::ctor::as_object)
+        .property("name",       &scene_node::name)
+        .property("id",         &scene_node::id)
+        .property("layer",      &scene_node::layer)
+        .property("visible",    &scene_node::visible)
+        .property("weight",     &scene_node::weight)
+        .property("state",      &scene_node::state)
+        .property("position",   &scene_node::position)
+        .property("tags",       &scene_node::tags)
+        .property("points",     &scene_node::points)
+        ;
+
+    registration::class_<scene>("scene")
+        .constructor()(policy::ctor::as_object)
+        .property("title",      &scene::title)
+        .property("nodes",      &scene::nodes)
+        .property("counters",   &scene::counters)
+        ;
+
+    registration::class_<scene_node_v2>("scene_node_v2")
+        .constructor()(policy::ctor::as_object)
+        .property("name",           &scene_node_v2::name)
+        .property("id",             &scene_node_v2::id)
+        .property("layer",          &scene_node_v2::layer)
+        .property("visible",        &scene_node_v2::visible)
+        .property("weight",         &scene_node_v2::weight)
+        .property("state",          &scene_node_v2::state)
+        .property("position",       &scene_node_v2::position)
+        .property("tags",           &scene_node_v2::tags)
+        .property("points",         &scene_node_v2::points)
+        .property("description",    &scene_node_v2::description)
+        .property("group",          &scene_node_v2::group)
+        .property("flags",          &scene_node_v2::flags)
+        .property("opacity",        &scene_node_v2::opacity)
+        .property("selected",       &scene_node_v2::selected)
+        .property("scale",          &scene_node_v2::scale)
+        .property("rotation",       &scene_node_v2::rotation)
+        .property("weights",        &scene_node_v2::weights)
+        .property("children",       &scene_node_v2::children)
+        ;
+
+    registration::class_<scene_v2>("scene_v2")
+        .constructor()(policy::ctor::as_object)
+        .property("title",      &scene_v2::title)
+        .property("nodes",      &scene_v2::nodes)
+        .property("counters",   &scene_v2::counters)
+        ;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+scene create_scene(std::size_t node_count)
+{
+    scene result;
+    result.title = "benchmark scene";
+    result.nodes.resize(node_count);
+
+    for (std::size_t i = 0; i < node_count; ++i)
+    {
+        auto& node = result.nodes[i];
+        node.name       = "node #" + std::to_string(i);
+        node.id         = static_cast<int32_t>(i);
+        node.layer      = static_cast<uint16_t>(i % 16);
+        node.visible    = (i % 3 != 0);
+        node.weight     = static_cast<float>(i) * 0.25f;
+        node.state      = static_cast<node_state>(i % 3);
+        node.position   = vector3{static_cast<double>(i), 2.0 * i, 0.5 * i};
+        node.tags       = std::vector<int>{1, 2, 3, 5, 8, 13, 21, static_cast<int>(i)};
+        node.points     = std::vector<vector3>(4, node.position);
+    }
+
+    result.counters = {{"created", static_cast<int>(node_count)}, {"deleted", 0}, {"modified", 42}};
+    return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+scene_v2 create_scene_v2(std::size_t node_count)
+{
+    const scene source = create_scene(node_count);
+
+    scene_v2 result;
+    result.title = source.title;
+    result.counters = source.counters;
+    result.nodes.resize(node_count);
+
+    for (std::size_t i = 0; i < node_count; ++i)
+    {
+        const auto& node = source.nodes[i];
+        auto& node_v2 = result.nodes[i];
+        node_v2.name        = node.name;
+        node_v2.id          = node.id;
+        node_v2.layer       = node.layer;
+        node_v2.visible     = node.visible;
+        node_v2.weight      = node.weight;
+        node_v2.state       = node.state;
+        node_v2.position    = node.position;
+        node_v2.tags        = node.tags;
+        node_v2.points      = node.points;
+
+        node_v2.description = "description of " + node.name;
+        node_v2.group       = static_cast<int32_t>(i / 10);
+        node_v2.flags       = static_cast<uint32_t>(i * 7);
+        node_v2.opacity     = 0.5f;
+        node_v2.selected    = (i % 2 == 0);
+        node_v2.scale       = vector3{1.0, 1.0, 1.0};
+        node_v2.rotation    = vector3{0.0, 0.5 * i, 0.0};
+        node_v2.weights     = std::vector<double>(4, 0.25);
+        node_v2.children    = std::vector<int>{static_cast<int>(i + 1), static_cast<int>(i + 2)};
+    }
+
+    return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
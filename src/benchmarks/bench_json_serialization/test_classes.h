@@ -0,0 +1,122 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_BENCH_JSON_SERIALIZATION_TEST_CLASSES_H_
+#define RTTR_BENCH_JSON_SERIALIZATION_TEST_CLASSES_H_
+
+#include <rttr/type>
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////
+// The following classes build a large object graph, in order to measure
+// the serialization of many small objects with basic type members.
+/////////////////////////////////////////////////////////////////////////////////////////
+
+enum class node_state
+{
+    idle,
+    active,
+    disabled
+};
+
+struct vector3
+{
+    double x = 0.0;
+    double y = 0.0;
+    double z = 0.0;
+};
+
+struct scene_node
+{
+    std::string         name;
+    int32_t             id          = 0;
+    uint16_t            layer       = 0;
+    bool                visible     = true;
+    float               weight      = 1.0f;
+    node_state          state       = node_state::idle;
+    vector3             position;
+    std::vector<int>    tags;
+    std::vector<vector3> points;
+};
+
+struct scene
+{
+    std::string                 title;
+    std::vector<scene_node>     nodes;
+    std::map<std::string, int>  counters;
+};
+
+/*!
+ * Creates a scene with \p node_count nodes, all of them with different values.
+ */
+scene create_scene(std::size_t node_count);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+// A later release of 'scene_node', with the same properties and as many new ones;
+// a reader of 'scene_node' does not know half of its properties.
+/////////////////////////////////////////////////////////////////////////////////////////
+
+struct scene_node_v2
+{
+    std::string         name;
+    int32_t             id          = 0;
+    uint16_t            layer       = 0;
+    bool                visible     = true;
+    float               weight      = 1.0f;
+    node_state          state       = node_state::idle;
+    vector3             position;
+    std::vector<int>    tags;
+    std::vector<vector3> points;
+
+    std::string         description;
+    int32_t             group       = 0;
+    uint32_t            flags       = 0;
+    float               opacity     = 1.0f;
+    bool                selected    = false;
+    vector3             scale;
+    vector3             rotation;
+    std::vector<double> weights;
+    std::vector<int>    children;
+};
+
+struct scene_v2
+{
+    std::string                 title;
+    std::vector<scene_node_v2>  nodes;
+    std::map<std::string, int>  counters;
+};
+
+/*!
+ * Creates a scene of the later release with \p node_count nodes.
+ */
+scene_v2 create_scene_v2(std::size_t node_count);
+
+#endif // RTTR_BENCH_JSON_SERIALIZATION_TEST_CLASSES_H_
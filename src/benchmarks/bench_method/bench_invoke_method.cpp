@@ -58,6 +58,18 @@ void bench_rttr_invoke_method_void_return_value()
     });
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_rttr_handle_invoke_method_void_return_value()
+{
+    ns_foo::method_class obj;
+    rttr::method_handle<void(ns_foo::method_class&)> handle(rttr::type::get(obj).get_method("method_0"));
+    ankerl::nanobench::Bench().run("rttr method handle invoke (void return)", [&]() {
+        handle(obj);
+        ankerl::nanobench::doNotOptimizeAway(obj);
+    });
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -83,6 +95,18 @@ void bench_rttr_invoke_method_int_return_value()
     });
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_rttr_handle_invoke_method_int_return_value()
+{
+    ns_foo::method_class obj;
+    rttr::method_handle<int(ns_foo::method_class&)> handle(rttr::type::get(obj).get_method("int_method"));
+    ankerl::nanobench::Bench().run("rttr method handle invoke (int return)", [&]() {
+        auto result = handle(obj);
+        ankerl::nanobench::doNotOptimizeAway(result);
+    });
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -108,6 +132,18 @@ void bench_rttr_invoke_method_string_return_value()
     });
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_rttr_handle_invoke_method_string_return_value()
+{
+    ns_foo::method_class obj;
+    rttr::method_handle<std::string(ns_foo::method_class&)> handle(rttr::type::get(obj).get_method("string_method"));
+    ankerl::nanobench::Bench().run("rttr method handle invoke (string return)", [&]() {
+        auto result = handle(obj);
+        ankerl::nanobench::doNotOptimizeAway(result);
+    });
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -133,6 +169,43 @@ void bench_rttr_invoke_method_arg_1()
     });
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_rttr_handle_invoke_method_arg_1()
+{
+    ns_foo::method_class obj;
+    rttr::method_handle<void(ns_foo::method_class&, int)> handle(rttr::type::get(obj).get_method("void_method_arg_1"));
+    ankerl::nanobench::Bench().run("rttr method handle invoke (1 arg)", [&]() {
+        handle(obj, 23);
+        ankerl::nanobench::doNotOptimizeAway(obj);
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_rttr_invoke_method_by_name_arg_1()
+{
+    ns_foo::method_class obj;
+    const rttr::type t = rttr::type::get(obj);
+    ankerl::nanobench::Bench().run("rttr type invoke by name (1 arg)", [&]() {
+        auto result = t.invoke("void_method_arg_1", obj, {23});
+        ankerl::nanobench::doNotOptimizeAway(result);
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_rttr_find_method_by_arg_types_arg_1()
+{
+    ns_foo::method_class obj;
+    const rttr::type t = rttr::type::get(obj);
+    const std::vector<rttr::type> arg_types = { rttr::type::get<int>() };
+    ankerl::nanobench::Bench().run("rttr find method by arg types (1 arg)", [&]() {
+        auto result = t.get_method("void_method_arg_1", arg_types);
+        ankerl::nanobench::doNotOptimizeAway(result);
+    });
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -158,6 +231,18 @@ void bench_rttr_invoke_method_arg_2()
     });
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_rttr_handle_invoke_method_arg_2()
+{
+    ns_foo::method_class obj;
+    rttr::method_handle<void(ns_foo::method_class&, int, int)> handle(rttr::type::get(obj).get_method("void_method_arg_2"));
+    ankerl::nanobench::Bench().run("rttr method handle invoke (2 args)", [&]() {
+        handle(obj, 23, 42);
+        ankerl::nanobench::doNotOptimizeAway(obj);
+    });
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -183,6 +268,18 @@ void bench_rttr_invoke_method_arg_3()
     });
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_rttr_handle_invoke_method_arg_3()
+{
+    ns_foo::method_class obj;
+    rttr::method_handle<void(ns_foo::method_class&, int, int, int)> handle(rttr::type::get(obj).get_method("void_method_arg_3"));
+    ankerl::nanobench::Bench().run("rttr method handle invoke (3 args)", [&]() {
+        handle(obj, 23, 42, 5);
+        ankerl::nanobench::doNotOptimizeAway(obj);
+    });
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -209,6 +306,18 @@ void bench_rttr_invoke_method_arg_8()
     });
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_rttr_handle_invoke_method_arg_8()
+{
+    ns_foo::method_class obj;
+    rttr::method_handle<void(ns_foo::method_class&, int, int, int, int, int, int, int, int)> handle(rttr::type::get(obj).get_method("void_method_arg_8"));
+    ankerl::nanobench::Bench().run("rttr method handle invoke (8 args)", [&]() {
+        handle(obj, 1, 2, 3, 4, 5, 6, 7, 8);
+        ankerl::nanobench::doNotOptimizeAway(obj);
+    });
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -236,6 +345,19 @@ void bench_rttr_invoke_method_ptr_arg()
     });
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_rttr_handle_invoke_method_ptr_arg()
+{
+    ns_foo::method_class obj;
+    rttr::method_handle<void(ns_foo::method_class&, int*)> handle(rttr::type::get(obj).get_method("method_ptr_arg"));
+    int* ptr = nullptr;
+    ankerl::nanobench::Bench().run("rttr method handle invoke (ptr arg)", [&]() {
+        handle(obj, ptr);
+        ankerl::nanobench::doNotOptimizeAway(obj);
+    });
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -248,41 +370,51 @@ void bench_invoke_method()
     std::cout << "[Group: void return value]" << std::endl;
     bench_native_invoke_method_void_return_value();
     bench_rttr_invoke_method_void_return_value();
+    bench_rttr_handle_invoke_method_void_return_value();
     std::cout << std::endl;
 
     std::cout << "[Group: int return value]" << std::endl;
     bench_native_invoke_method_int_return_value();
     bench_rttr_invoke_method_int_return_value();
+    bench_rttr_handle_invoke_method_int_return_value();
     std::cout << std::endl;
 
     std::cout << "[Group: string return value]" << std::endl;
     bench_native_invoke_method_string_return_value();
     bench_rttr_invoke_method_string_return_value();
+    bench_rttr_handle_invoke_method_string_return_value();
     std::cout << std::endl;
 
     std::cout << "[Group: 1 argument]" << std::endl;
     bench_native_invoke_method_arg_1();
     bench_rttr_invoke_method_arg_1();
+    bench_rttr_handle_invoke_method_arg_1();
+    bench_rttr_invoke_method_by_name_arg_1();
+    bench_rttr_find_method_by_arg_types_arg_1();
     std::cout << std::endl;
 
     std::cout << "[Group: 2 arguments]" << std::endl;
     bench_native_invoke_method_arg_2();
     bench_rttr_invoke_method_arg_2();
+    bench_rttr_handle_invoke_method_arg_2();
     std::cout << std::endl;
 
     std::cout << "[Group: 3 arguments]" << std::endl;
     bench_native_invoke_method_arg_3();
     bench_rttr_invoke_method_arg_3();
+    bench_rttr_handle_invoke_method_arg_3();
     std::cout << std::endl;
 
     std::cout << "[Group: 8 arguments (variadic)]" << std::endl;
     bench_native_invoke_method_arg_8();
     bench_rttr_invoke_method_arg_8();
+    bench_rttr_handle_invoke_method_arg_8();
     std::cout << std::endl;
 
     std::cout << "[Group: pointer argument]" << std::endl;
     bench_native_invoke_method_ptr_arg();
     bench_rttr_invoke_method_ptr_arg();
+    bench_rttr_handle_invoke_method_ptr_arg();
     std::cout << std::endl;
 
     std::cout << "=== Benchmark Complete ===" << std::endl;
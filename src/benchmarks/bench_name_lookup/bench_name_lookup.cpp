@@ -0,0 +1,316 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "benchmarks/bench_name_lookup/test_classes.h"
+
+#include <rttr/type>
+#include <rttr/registration>
+
+#include <nanobench.h>
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The linear scan, which was used before the name index was introduced:
+ * the flattened member list is searched from the end, so the most-derived item is found.
+ */
+template<typename T>
+static const T* find_linear(const std::vector<T>& items, rttr::string_view name)
+{
+    auto ret = std::find_if(items.crbegin(), items.crend(),
+                            [name](const T& item)
+                            {
+                                return (item.get_name() == name);
+                            });
+    return (ret != items.crend()) ? &(*ret) : nullptr;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static const auto all_members = rttr::filter_item::instance_item | rttr::filter_item::static_item |
+                                rttr::filter_item::public_access | rttr::filter_item::non_public_access;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static void bench_linear_find_property(const char* title, const std::string& name)
+{
+    const auto range = rttr::type::get<lookup_derived>().get_properties(all_members);
+    const std::vector<rttr::property> props(range.begin(), range.end());
+    volatile std::size_t value = 0;
+
+    ankerl::nanobench::Bench().run(std::string("linear scan find property ") + title, [&]() {
+        if (find_linear(props, name))
+        {
+            value = 1;
+        }
+        ankerl::nanobench::doNotOptimizeAway(static_cast<std::size_t>(value));
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static void bench_rttr_find_property(const char* title, const std::string& name)
+{
+    const auto t = rttr::type::get<lookup_derived>();
+    volatile std::size_t value = 0;
+
+    ankerl::nanobench::Bench().run(std::string("rttr find property ") + title, [&]() {
+        if (t.get_property(name))
+        {
+            value = 1;
+        }
+        ankerl::nanobench::doNotOptimizeAway(static_cast<std::size_t>(value));
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static void bench_rttr_find_property_key(const char* title, const std::string& name)
+{
+    const auto t = rttr::type::get<lookup_derived>();
+    const rttr::name_key key(name); // hashed once, outside of the loop
+    volatile std::size_t value = 0;
+
+    ankerl::nanobench::Bench().run(std::string("rttr find property with name_key ") + title, [&]() {
+        if (t.get_property(key))
+        {
+            value = 1;
+        }
+        ankerl::nanobench::doNotOptimizeAway(static_cast<std::size_t>(value));
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static void bench_linear_find_method(const char* title, const std::string& name)
+{
+    const auto range = rttr::type::get<lookup_derived>().get_methods(all_members);
+    const std::vector<rttr::method> meths(range.begin(), range.end());
+    volatile std::size_t value = 0;
+
+    ankerl::nanobench::Bench().run(std::string("linear scan find method ") + title, [&]() {
+        if (find_linear(meths, name))
+        {
+            value = 1;
+        }
+        ankerl::nanobench::doNotOptimizeAway(static_cast<std::size_t>(value));
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static void bench_rttr_find_method(const char* title, const std::string& name)
+{
+    const auto t = rttr::type::get<lookup_derived>();
+    volatile std::size_t value = 0;
+
+    ankerl::nanobench::Bench().run(std::string("rttr find method ") + title, [&]() {
+        if (t.get_method(name))
+        {
+            value = 1;
+        }
+        ankerl::nanobench::doNotOptimizeAway(static_cast<std::size_t>(value));
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static void bench_rttr_find_method_key(const char* title, const std::string& name)
+{
+    const auto t = rttr::type::get<lookup_derived>();
+    const rttr::name_key key(name); // hashed once, outside of the loop
+    volatile std::size_t value = 0;
+
+    ankerl::nanobench::Bench().run(std::string("rttr find method with name_key ") + title, [&]() {
+        if (t.get_method(key))
+        {
+            value = 1;
+        }
+        ankerl::nanobench::doNotOptimizeAway(static_cast<std::size_t>(value));
+    });
+}
+
+static void bench_rttr_get_by_name(const char* title, const std::string& name)
+{
+    volatile std::size_t value = 0;
+
+    ankerl::nanobench::Bench().run(std::string("rttr type::get_by_name ") + title, [&]() {
+        if (rttr::type::get_by_name(name))
+        {
+            value = 1;
+        }
+        ankerl::nanobench::doNotOptimizeAway(static_cast<std::size_t>(value));
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static void bench_rttr_convert(const char* title)
+{
+    const rttr::variant var = lookup_base();
+    volatile std::size_t value = 0;
+
+    ankerl::nanobench::Bench().run(std::string("rttr variant::can_convert ") + title, [&]() {
+        if (var.can_convert<lookup_converted>())
+        {
+            value = 1;
+        }
+        ankerl::nanobench::doNotOptimizeAway(static_cast<std::size_t>(value));
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Iterates the members, which match a filter, the way it was done before the filtered lists were cached:
+ * the predicate is a std::function, which is called for every member of the class.
+ */
+static void bench_predicate_filter_properties(rttr::filter_items filter)
+{
+    const auto t = rttr::type::get<lookup_derived>();
+    const auto range = t.get_properties(all_members);
+    const std::vector<rttr::property> props(range.begin(), range.end());
+    volatile std::size_t value = 0;
+
+    ankerl::nanobench::Bench().run("predicate filter properties", [&]() {
+        const rttr::array_range<rttr::property> filtered(props.data(), props.size(),
+            rttr::detail::default_predicate<rttr::property>([filter, t](const rttr::property& prop)
+            {
+                return ((!filter.test_flag(rttr::filter_item::declared_only) || prop.get_declaring_type() == t) &&
+                        prop.get_access_level() == rttr::access_levels::public_access);
+            }));
+
+        std::size_t count = 0;
+        for (const auto& prop : filtered)
+            count += prop.get_name().size();
+        value = count;
+        ankerl::nanobench::doNotOptimizeAway(static_cast<std::size_t>(value));
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static void bench_rttr_filter_properties(rttr::filter_items filter)
+{
+    const auto t = rttr::type::get<lookup_derived>();
+    volatile std::size_t value = 0;
+
+    ankerl::nanobench::Bench().run("rttr filter properties", [&]() {
+        std::size_t count = 0;
+        for (const auto& prop : t.get_properties(filter))
+            count += prop.get_name().size();
+        value = count;
+        ankerl::nanobench::doNotOptimizeAway(static_cast<std::size_t>(value));
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static void bench_lookups(const char* title)
+{
+    const auto last_derived = member_count_per_class - 1;
+
+    std::cout << "[Group: " << title << "]" << std::endl;
+    bench_rttr_get_by_name(title, "lookup_derived");
+    bench_rttr_find_property(title, get_member_name("derived_prop_", last_derived));
+    bench_rttr_find_property_key(title, get_member_name("derived_prop_", last_derived));
+    bench_rttr_find_method(title, get_member_name("base_meth_", 0));
+    bench_rttr_find_method_key(title, get_member_name("base_meth_", 0));
+    bench_rttr_convert(title);
+    std::cout << std::endl;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_name_lookup()
+{
+    std::cout << "=== Name Lookup Benchmark ===" << std::endl;
+    std::cout << "Running benchmarks for RTTR member lookup by name vs a linear scan over "
+              << rttr::type::get<lookup_derived>().get_properties().size() << " properties..." << std::endl << std::endl;
+
+    const auto last_derived = member_count_per_class - 1;
+
+    std::cout << "[Group: property most-derived]" << std::endl;
+    bench_linear_find_property("most-derived", get_member_name("derived_prop_", last_derived));
+    bench_rttr_find_property("most-derived", get_member_name("derived_prop_", last_derived));
+    bench_rttr_find_property_key("most-derived", get_member_name("derived_prop_", last_derived));
+    std::cout << std::endl;
+
+    std::cout << "[Group: property root base]" << std::endl;
+    bench_linear_find_property("root base", get_member_name("base_prop_", 0));
+    bench_rttr_find_property("root base", get_member_name("base_prop_", 0));
+    bench_rttr_find_property_key("root base", get_member_name("base_prop_", 0));
+    std::cout << std::endl;
+
+    std::cout << "[Group: property not found]" << std::endl;
+    bench_linear_find_property("not found", "unknown_prop");
+    bench_rttr_find_property("not found", "unknown_prop");
+    bench_rttr_find_property_key("not found", "unknown_prop");
+    std::cout << std::endl;
+
+    std::cout << "[Group: method most-derived]" << std::endl;
+    bench_linear_find_method("most-derived", get_member_name("derived_meth_", last_derived));
+    bench_rttr_find_method("most-derived", get_member_name("derived_meth_", last_derived));
+    bench_rttr_find_method_key("most-derived", get_member_name("derived_meth_", last_derived));
+    std::cout << std::endl;
+
+    std::cout << "[Group: method root base]" << std::endl;
+    bench_linear_find_method("root base", get_member_name("base_meth_", 0));
+    bench_rttr_find_method("root base", get_member_name("base_meth_", 0));
+    bench_rttr_find_method_key("root base", get_member_name("base_meth_", 0));
+    std::cout << std::endl;
+
+    std::cout << "[Group: method not found]" << std::endl;
+    bench_linear_find_method("not found", "unknown_meth");
+    bench_rttr_find_method("not found", "unknown_meth");
+    bench_rttr_find_method_key("not found", "unknown_meth");
+    std::cout << std::endl;
+
+    std::cout << "[Group: iterate public declared properties]" << std::endl;
+    const auto declared_filter = rttr::filter_item::instance_item | rttr::filter_item::static_item |
+                                 rttr::filter_item::public_access | rttr::filter_item::declared_only;
+    bench_predicate_filter_properties(declared_filter);
+    bench_rttr_filter_properties(declared_filter);
+    std::cout << std::endl;
+
+    // the frozen registry is never thawed again in this process, so these groups run last
+    bench_lookups("registry");
+    if (!rttr::registration::freeze())
+        std::cout << "The registry could not be frozen!" << std::endl;
+    bench_lookups("frozen registry");
+
+    std::cout << "=== Benchmark Complete ===" << std::endl;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
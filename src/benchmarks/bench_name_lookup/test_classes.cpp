@@ -0,0 +1,75 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "benchmarks/bench_name_lookup/test_classes.h"
+
+#include <rttr/registration>
+
+#include <deque>
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+// the registered names are stored as string_view, so we have to keep the strings alive
+static rttr::string_view persist_name(std::string name)
+{
+    static std::deque<std::string> name_storage;
+    name_storage.push_back(std::move(name));
+    return name_storage.back();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static lookup_converted convert_to_lookup_converted(const lookup_base& obj, bool& ok)
+{
+    ok = true;
+    return lookup_converted{obj.value};
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_REGISTRATION
+{
+    using namespace rttr;
+
+    registration::class_<lookup_base> base_class("lookup_base");
+    for (std::size_t i = 0; i < member_count_per_class; ++i)
+    {
+        base_class.property(persist_name(get_member_name("base_prop_", i)), &lookup_base::value);
+        base_class.method(persist_name(get_member_name("base_meth_", i)), &lookup_base::get_value);
+    }
+
+    registration::class_<lookup_derived> derived_class("lookup_derived");
+    for (std::size_t i = 0; i < member_count_per_class; ++i)
+    {
+        derived_class.property(persist_name(get_member_name("derived_prop_", i)), &lookup_derived::value);
+        derived_class.method(persist_name(get_member_name("derived_meth_", i)), &lookup_derived::get_value);
+    }
+
+    type::register_converter_func(convert_to_lookup_converted);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
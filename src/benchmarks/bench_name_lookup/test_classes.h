@@ -0,0 +1,75 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_BENCH_NAME_LOOKUP_TEST_CLASSES_H_
+#define RTTR_BENCH_NAME_LOOKUP_TEST_CLASSES_H_
+
+#include <rttr/type>
+
+#include <string>
+
+/////////////////////////////////////////////////////////////////////////////////////////
+// The following classes will be registered with a lot of properties and methods,
+// in order to measure the lookup of a class member by its name.
+// The derived class contains also all members of its base class.
+/////////////////////////////////////////////////////////////////////////////////////////
+
+struct lookup_base
+{
+    virtual ~lookup_base() {}
+
+    int get_value() const { return value; }
+
+    int value = 0;
+
+    RTTR_ENABLE()
+};
+
+struct lookup_derived : lookup_base
+{
+    RTTR_ENABLE(lookup_base)
+};
+
+//! The target type of the converter, which is registered for \ref lookup_base
+struct lookup_converted
+{
+    int value = 0;
+};
+
+//! The number of properties and methods, which are registered for every class
+static const std::size_t member_count_per_class = 160;
+
+/*!
+ * Returns the name of the member with the given index,
+ * e.g. get_member_name("base_prop_", 42) => "base_prop_42"
+ */
+inline std::string get_member_name(const char* prefix, std::size_t index)
+{
+    return std::string(prefix) + std::to_string(index);
+}
+
+#endif // RTTR_BENCH_NAME_LOOKUP_TEST_CLASSES_H_
@@ -0,0 +1,211 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "benchmarks/bench_property/test_classes.h"
+
+#include <rttr/type>
+#include <rttr/property_accessor.h>
+
+#include <nanobench.h>
+#include <iostream>
+#include <string>
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+void bench_property_get_set(const std::string& group, const char* prop_name, T property_class::* member)
+{
+    property_class src, dst;
+    rttr::property prop = rttr::type::get<property_class>().get_property(prop_name);
+    rttr::property_accessor<property_class, T> acc(prop);
+
+    std::cout << "[Group: " << group << "]" << std::endl;
+
+    ankerl::nanobench::Bench().run("native get", [&]() {
+        T value = src.*member;
+        ankerl::nanobench::doNotOptimizeAway(value);
+    });
+
+    ankerl::nanobench::Bench().run("rttr property get_value", [&]() {
+        auto value = prop.get_value(src);
+        ankerl::nanobench::doNotOptimizeAway(value);
+    });
+
+    ankerl::nanobench::Bench().run("rttr property_accessor get", [&]() {
+        T value = acc.get(src);
+        ankerl::nanobench::doNotOptimizeAway(value);
+    });
+
+    ankerl::nanobench::Bench().run("native copy", [&]() {
+        dst.*member = src.*member;
+        ankerl::nanobench::doNotOptimizeAway(dst);
+    });
+
+    ankerl::nanobench::Bench().run("rttr property copy (get_value + set_value)", [&]() {
+        prop.set_value(dst, prop.get_value(src));
+        ankerl::nanobench::doNotOptimizeAway(dst);
+    });
+
+    ankerl::nanobench::Bench().run("rttr property_accessor copy (get_ref + set)", [&]() {
+        acc.set(dst, acc.get_ref(src));
+        ankerl::nanobench::doNotOptimizeAway(dst);
+    });
+
+    std::cout << std::endl;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+void bench_property_getter_setter(const std::string& group, const char* prop_name,
+                                  const T& (property_class::*getter)() const, void (property_class::*setter)(const T&))
+{
+    property_class src, dst;
+    rttr::property prop = rttr::type::get<property_class>().get_property(prop_name);
+    rttr::property_accessor<property_class, T> acc(prop);
+
+    std::cout << "[Group: " << group << "]" << std::endl;
+
+    ankerl::nanobench::Bench().run("native copy", [&]() {
+        (dst.*setter)((src.*getter)());
+        ankerl::nanobench::doNotOptimizeAway(dst);
+    });
+
+    ankerl::nanobench::Bench().run("rttr property copy (get_value + set_value)", [&]() {
+        prop.set_value(dst, prop.get_value(src));
+        ankerl::nanobench::doNotOptimizeAway(dst);
+    });
+
+    ankerl::nanobench::Bench().run("rttr property_accessor copy (get + set)", [&]() {
+        acc.set(dst, acc.get(src));
+        ankerl::nanobench::doNotOptimizeAway(dst);
+    });
+
+    std::cout << std::endl;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_property_getter_setter_int()
+{
+    property_class src, dst;
+    rttr::property prop = rttr::type::get<property_class>().get_property("int_value_func");
+    rttr::property_accessor<property_class, int> acc(prop);
+
+    std::cout << "[Group: int getter/setter]" << std::endl;
+
+    ankerl::nanobench::Bench().run("native copy", [&]() {
+        dst.set_int_value(src.get_int_value());
+        ankerl::nanobench::doNotOptimizeAway(dst);
+    });
+
+    ankerl::nanobench::Bench().run("rttr property copy (get_value + set_value)", [&]() {
+        prop.set_value(dst, prop.get_value(src));
+        ankerl::nanobench::doNotOptimizeAway(dst);
+    });
+
+    ankerl::nanobench::Bench().run("rttr property_accessor copy (get + set)", [&]() {
+        acc.set(dst, acc.get(src));
+        ankerl::nanobench::doNotOptimizeAway(dst);
+    });
+
+    std::cout << std::endl;
+}
+
+void bench_metadata()
+{
+    const rttr::type t = rttr::type::get<metadata_class>();
+    const rttr::property prop = t.get_property("value");
+
+    std::cout << "[Group: metadata]" << std::endl;
+
+    ankerl::nanobench::Bench().run("rttr property get_metadata (enum key)", [&]() {
+        auto value = prop.get_metadata(field_hint::max_value);
+        ankerl::nanobench::doNotOptimizeAway(value);
+    });
+
+    ankerl::nanobench::Bench().run("rttr property get_metadata (string key)", [&]() {
+        auto value = prop.get_metadata("label");
+        ankerl::nanobench::doNotOptimizeAway(value);
+    });
+
+    ankerl::nanobench::Bench().run("rttr property get_metadata<T> (enum key)", [&]() {
+        const int* value = prop.get_metadata<int>(field_hint::max_value);
+        ankerl::nanobench::doNotOptimizeAway(value);
+    });
+
+    ankerl::nanobench::Bench().run("rttr property get_metadata<T> (string key)", [&]() {
+        const std::string* value = prop.get_metadata<std::string>("label");
+        ankerl::nanobench::doNotOptimizeAway(value);
+    });
+
+    ankerl::nanobench::Bench().run("rttr type get_metadata (string key)", [&]() {
+        auto value = t.get_metadata("version");
+        ankerl::nanobench::doNotOptimizeAway(value);
+    });
+
+    ankerl::nanobench::Bench().run("rttr type get_metadata<T> (string key)", [&]() {
+        const int* value = t.get_metadata<int>("version");
+        ankerl::nanobench::doNotOptimizeAway(value);
+    });
+
+    ankerl::nanobench::Bench().run("rttr type get_metadata (missing key)", [&]() {
+        auto value = t.get_metadata("missing");
+        ankerl::nanobench::doNotOptimizeAway(value);
+    });
+
+    ankerl::nanobench::Bench().run("rttr type get_metadata<T> (missing key)", [&]() {
+        const int* value = t.get_metadata<int>("missing");
+        ankerl::nanobench::doNotOptimizeAway(value);
+    });
+
+    std::cout << std::endl;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_property()
+{
+    std::cout << "=== Property Access Benchmark ===" << std::endl;
+    std::cout << "Running benchmarks for RTTR property access vs native member access..." << std::endl << std::endl;
+
+    bench_property_get_set("int member", "int_value", &property_class::int_value);
+    bench_property_get_set("double member", "double_value", &property_class::double_value);
+    bench_property_get_set("string member", "string_value", &property_class::string_value);
+    bench_property_getter_setter_int();
+    bench_property_getter_setter("string getter/setter", "string_value_func",
+                                 &property_class::get_string_value, &property_class::set_string_value);
+    bench_metadata();
+
+    std::cout << "=== Benchmark Complete ===" << std::endl;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,9 @@
+// std stuff
+#include <deque>
+#include <string>
+#include <vector>
+#include <iostream>
+
+#include <rttr/type>
+
+#include <nanobench.h>
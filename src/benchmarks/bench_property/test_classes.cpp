@@ -0,0 +1,62 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "benchmarks/bench_property/test_classes.h"
+
+#include <rttr/registration>
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_REGISTRATION
+{
+    using namespace rttr;
+
+    registration::class_<property_class>("property_class")
+        .property("int_value", &property_class::int_value)
+        .property("double_value", &property_class::double_value)
+        .property("string_value", &property_class::string_value)
+        .property("int_value_func", &property_class::get_int_value, &property_class::set_int_value)
+        .property("string_value_func", &property_class::get_string_value, &property_class::set_string_value)
+        ;
+
+    registration::class_<metadata_class>("metadata_class")
+        (
+            metadata("description", "a class with some metadata"),
+            metadata("version", 3),
+            metadata(field_hint::serialize, true)
+        )
+        .property("value", &metadata_class::value)
+        (
+            metadata(field_hint::min_value, 0),
+            metadata(field_hint::max_value, 100),
+            metadata(field_hint::serialize, true),
+            metadata("label", "Value")
+        )
+        ;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
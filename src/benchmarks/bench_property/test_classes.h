@@ -0,0 +1,73 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_BENCH_PROPERTY_TEST_CLASSES_H_
+#define RTTR_BENCH_PROPERTY_TEST_CLASSES_H_
+
+#include <rttr/type>
+
+#include <string>
+
+/////////////////////////////////////////////////////////////////////////////////////////
+// The following class is registered with member object properties and
+// getter/setter properties, in order to measure the access of a property value.
+/////////////////////////////////////////////////////////////////////////////////////////
+
+struct property_class
+{
+    int get_int_value() const { return int_value_func; }
+    void set_int_value(int value) { int_value_func = value; }
+
+    const std::string& get_string_value() const { return string_value_func; }
+    void set_string_value(const std::string& value) { string_value_func = value; }
+
+    int         int_value       = 23;
+    double      double_value    = 42.0;
+    std::string string_value    = "a string which is too long for small string optimization";
+
+    int         int_value_func      = 12;
+    std::string string_value_func   = "another string which is too long for small string optimization";
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+// The following class is registered with metadata on the type and its property,
+// in order to measure the lookup of metadata.
+/////////////////////////////////////////////////////////////////////////////////////////
+
+enum class field_hint
+{
+    min_value,
+    max_value,
+    serialize
+};
+
+struct metadata_class
+{
+    int value = 0;
+};
+
+#endif // RTTR_BENCH_PROPERTY_TEST_CLASSES_H_
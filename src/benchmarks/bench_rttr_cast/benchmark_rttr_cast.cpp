@@ -760,6 +760,85 @@ void bench_level_6_type()
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+template<typename T>
+std::vector<type> get_dynamic_types(const bench_data<T>& data)
+{
+    std::vector<type> types;
+    types.reserve(data.m_vec.size());
+    for (const auto& item : data.m_vec)
+        types.push_back(type::get(*item));
+
+    return types;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_level_6_is_derived_from()
+{
+    const std::vector<type> types = get_dynamic_types(setup_level_6());
+    const type target_types[] = { type::get<ClassSingle6A>(), type::get<ClassSingle6B>(), type::get<ClassSingle6C>(),
+                                  type::get<ClassSingle6D>(), type::get<ClassSingle6E>() };
+
+    ankerl::nanobench::Bench().run("level 6 type::is_derived_from", [&]() {
+        volatile std::size_t value = 0;
+        for (const auto& t : types)
+        {
+            for (const auto& target : target_types)
+            {
+                if (t.is_derived_from(target))
+                    value += 1;
+            }
+        }
+        ankerl::nanobench::doNotOptimizeAway(static_cast<std::size_t>(value));
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_level_6_is_base_of()
+{
+    const std::vector<type> types = get_dynamic_types(setup_level_6());
+    const type base_types[] = { type::get<ClassSingle1A>(), type::get<ClassSingle3B>(), type::get<ClassSingle6C>(),
+                                type::get<ClassSingle2D>(), type::get<ClassSingle5E>() };
+
+    ankerl::nanobench::Bench().run("level 6 type::is_base_of", [&]() {
+        volatile std::size_t value = 0;
+        for (const auto& t : types)
+        {
+            for (const auto& base : base_types)
+            {
+                if (base.is_base_of(t))
+                    value += 1;
+            }
+        }
+        ankerl::nanobench::doNotOptimizeAway(static_cast<std::size_t>(value));
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_multiple_inheritance_is_derived_from()
+{
+    const std::vector<type> types = get_dynamic_types(setup_multiple_class_hierachy());
+    const type target_types[] = { type::get<ClassMultiple1A>(), type::get<ClassMultiple3B>(), type::get<ClassMultiple4C>(),
+                                  type::get<ClassMultiple6A>(), type::get<FinalClass>() };
+
+    ankerl::nanobench::Bench().run("multiple inheritance type::is_derived_from", [&]() {
+        volatile std::size_t value = 0;
+        for (const auto& t : types)
+        {
+            for (const auto& target : target_types)
+            {
+                if (t.is_derived_from(target))
+                    value += 1;
+            }
+        }
+        ankerl::nanobench::doNotOptimizeAway(static_cast<std::size_t>(value));
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -809,6 +888,11 @@ void start_rttr_cast_benchmark()
     bench_level_6_typeid();
     bench_level_6_type();
 
+    std::cout << "\nSubtype check - type::is_derived_from and type::is_base_of on the dynamic type of each object:" << std::endl;
+    bench_level_6_is_derived_from();
+    bench_level_6_is_base_of();
+    bench_multiple_inheritance_is_derived_from();
+
     std::cout << "\nBenchmarks completed!" << std::endl;
 }
 
@@ -25,8 +25,10 @@
 #                                                                                  #
 ####################################################################################
 
-set(HEADER_FILES version.rc.in)
+set(HEADER_FILES version.rc.in
+                 allocation_counter.h)
 
 set(SOURCE_FILES main.cpp
+                 allocation_counter.cpp
                  bench_variant_conversion.cpp
                  bench_variant_create.cpp)
@@ -91,6 +91,13 @@ static std::string setup_string_bool()
     return std::string("1");
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static std::string setup_string_invalid_number()
+{
+    return std::string("12345 and text");
+}
+
 
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -293,6 +300,186 @@ void bench_variant_string_to_bool()
     });
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_native_invalid_string_to_int()
+{
+    std::string text = setup_string_invalid_number();
+    ankerl::nanobench::Bench().run("native invalid string to int", [&]() {
+        int result = 0;
+        try
+        {
+            std::size_t pos = 0;
+            result = std::stoi(text, &pos);
+            if (pos != text.length())
+                result = 0;
+        }
+        catch (...)
+        {
+        }
+        ankerl::nanobench::doNotOptimizeAway(result);
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_variant_invalid_string_to_int()
+{
+    rttr::variant var = setup_string_invalid_number();
+    ankerl::nanobench::Bench().run("variant invalid string to int", [&]() {
+        bool ok = false;
+        int result = var.to_int(&ok);
+        ankerl::nanobench::doNotOptimizeAway(result);
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_variant_invalid_string_to_double()
+{
+    rttr::variant var = std::string("text");
+    ankerl::nanobench::Bench().run("variant invalid string to double", [&]() {
+        bool ok = false;
+        double result = var.to_double(&ok);
+        ankerl::nanobench::doNotOptimizeAway(result);
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_variant_out_of_range_string_to_int()
+{
+    rttr::variant var = std::string("99999999999999999999");
+    ankerl::nanobench::Bench().run("variant out of range string to int", [&]() {
+        bool ok = false;
+        int result = var.to_int(&ok);
+        ankerl::nanobench::doNotOptimizeAway(result);
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Target_Type>
+static void bench_variant_basic_convert(const char* name, rttr::variant source)
+{
+    const rttr::type target_type = rttr::type::get<Target_Type>();
+    ankerl::nanobench::Bench().run(std::string("variant convert(type) ") + name, [&]() {
+        rttr::variant var = source;
+        bool ok = var.convert(target_type);
+        ankerl::nanobench::doNotOptimizeAway(ok);
+    });
+
+    ankerl::nanobench::Bench().run(std::string("variant convert<T> ") + name, [&]() {
+        bool ok = false;
+        Target_Type result = source.convert<Target_Type>(&ok);
+        ankerl::nanobench::doNotOptimizeAway(result);
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+enum class bench_color : int
+{
+    red,
+    green,
+    blue
+};
+
+RTTR_REGISTRATION
+{
+    rttr::registration::enumeration<bench_color>("bench_color")
+    (
+        rttr::value("red",      bench_color::red),
+        rttr::value("green",    bench_color::green),
+        rttr::value("blue",     bench_color::blue)
+    );
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_variant_basic_type_conversion()
+{
+    bench_variant_basic_convert<bool>("int to bool", 12345);
+    bench_variant_basic_convert<int8_t>("double to int8_t", 12.0);
+    bench_variant_basic_convert<uint64_t>("bool to uint64_t", true);
+    bench_variant_basic_convert<float>("int to float", 12345);
+    bench_variant_basic_convert<double>("int to double", 12345);
+    bench_variant_basic_convert<double>("uint8_t to double", uint8_t(123));
+    bench_variant_basic_convert<int>("enum to int", bench_color::blue);
+    bench_variant_basic_convert<double>("enum to double", bench_color::blue);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+struct celsius
+{
+    double value;
+    bool operator==(const celsius& other) const { return (value == other.value); }
+};
+
+struct fahrenheit
+{
+    double value;
+};
+
+static fahrenheit celsius_to_fahrenheit(const celsius& temp, bool& ok)
+{
+    ok = true;
+    return fahrenheit{temp.value * 9.0 / 5.0 + 32.0};
+}
+
+static void setup_custom_converter()
+{
+    static const bool registered = []()
+    {
+        rttr::type::register_converter_func(celsius_to_fahrenheit);
+        rttr::type::register_equal_comparator<celsius>();
+        return true;
+    }();
+    (void)registered;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_native_custom_conversion()
+{
+    celsius temp{21.5};
+    ankerl::nanobench::Bench().run("native custom conversion", [&]() {
+        bool ok = false;
+        fahrenheit result = celsius_to_fahrenheit(temp, ok);
+        ankerl::nanobench::doNotOptimizeAway(result);
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_variant_custom_conversion()
+{
+    setup_custom_converter();
+    rttr::variant var = celsius{21.5};
+    ankerl::nanobench::Bench().run("variant custom conversion", [&]() {
+        bool ok = false;
+        fahrenheit result = var.convert<fahrenheit>(&ok);
+        ankerl::nanobench::doNotOptimizeAway(result);
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_variant_custom_compare()
+{
+    setup_custom_converter();
+    rttr::variant lhs = celsius{21.5};
+    rttr::variant rhs = celsius{21.5};
+    ankerl::nanobench::Bench().run("variant custom compare", [&]() {
+        bool result = (lhs == rhs);
+        ankerl::nanobench::doNotOptimizeAway(result);
+    });
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -332,6 +519,20 @@ void bench_variant_conversion()
     std::cout << "\n-- string to bool conversion --" << std::endl;
     bench_native_string_to_bool();
     bench_variant_string_to_bool();
+
+    std::cout << "\n-- invalid string to number conversion --" << std::endl;
+    bench_native_invalid_string_to_int();
+    bench_variant_invalid_string_to_int();
+    bench_variant_invalid_string_to_double();
+    bench_variant_out_of_range_string_to_int();
+
+    std::cout << "\n-- basic type conversion --" << std::endl;
+    bench_variant_basic_type_conversion();
+
+    std::cout << "\n-- custom type conversion --" << std::endl;
+    bench_native_custom_conversion();
+    bench_variant_custom_conversion();
+    bench_variant_custom_compare();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -29,8 +29,14 @@
 #include <rttr/registration>
 #include <rttr/variant.h>
 
+#include "allocation_counter.h"
+
 #include <nanobench.h>
 #include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+#include <utility>
 
 struct MyCustomType
 {
@@ -41,6 +47,11 @@ struct MyCustomType
     std::size_t m_data_st;
 };
 
+struct payload_16 { char m_data[16] = {}; };
+struct payload_24 { char m_data[24] = {}; };
+struct payload_32 { char m_data[32] = {}; };
+struct payload_48 { char m_data[48] = {}; };
+
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
@@ -237,6 +248,112 @@ void bench_variant_custom_dtor()
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 
+template<typename Func>
+static double count_allocations(Func&& func)
+{
+    const std::size_t iterations = 1000;
+    const auto start_count = allocation_counter::get_count();
+    for (std::size_t i = 0; i < iterations; ++i)
+        func();
+
+    return static_cast<double>(allocation_counter::get_count() - start_count) / iterations;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+void bench_variant_buffer_size_type(const std::string& name, const T& value)
+{
+    const auto create = [&]() { rttr::variant var(value); ankerl::nanobench::doNotOptimizeAway(var); };
+    const rttr::variant src(value);
+    const auto copy = [&]() { rttr::variant var(src); ankerl::nanobench::doNotOptimizeAway(var); };
+
+    std::cout << name << " (" << sizeof(T) << " bytes, "
+              << (rttr::detail::can_place_in_variant<T>::value ? "inline" : "heap") << "): "
+              << count_allocations(create) << " allocs/construct, "
+              << count_allocations(copy) << " allocs/copy" << std::endl;
+
+    ankerl::nanobench::Bench().run(name + " construct + destroy", create);
+    ankerl::nanobench::Bench().run(name + " copy + destroy", copy);
+
+    ankerl::nanobench::Bench().run(name + " destructor", [&]() {
+        auto var = std::make_unique<rttr::variant>(src);
+        ankerl::nanobench::doNotOptimizeAway(var.get());
+        var.reset();
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_variant_buffer_size()
+{
+    std::cout << "\n-- Inline buffer size: " << sizeof(rttr::detail::variant_data)
+              << " bytes (RTTR_VARIANT_BUFFER_SIZE) --" << std::endl;
+
+    bench_variant_buffer_size_type("int", 42);
+    bench_variant_buffer_size_type("std::pair<int,int>", std::make_pair(23, 42));
+    bench_variant_buffer_size_type("std::shared_ptr<int>", std::make_shared<int>(42));
+    bench_variant_buffer_size_type("std::string", std::string("hello"));
+    bench_variant_buffer_size_type("custom type", MyCustomType{});
+    bench_variant_buffer_size_type("payload_16", payload_16{});
+    bench_variant_buffer_size_type("payload_24", payload_24{});
+    bench_variant_buffer_size_type("payload_32", payload_32{});
+    bench_variant_buffer_size_type("payload_48", payload_48{});
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static void* plain_allocate(std::size_t size, std::size_t alignment)
+{
+    return ::operator new(size, std::align_val_t(alignment));
+}
+
+static void plain_deallocate(void* ptr, std::size_t, std::size_t alignment) noexcept
+{
+    ::operator delete(ptr, std::align_val_t(alignment));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+void bench_variant_allocator_type(const std::string& name, const T& value)
+{
+    const auto churn = [&]()
+    {
+        rttr::variant var(value);
+        rttr::variant var_copy(var);
+        ankerl::nanobench::doNotOptimizeAway(var_copy);
+    };
+
+    rttr::set_variant_allocator({&plain_allocate, &plain_deallocate});
+    std::cout << name << " operator new: " << count_allocations(churn) << " allocs/iteration" << std::endl;
+    ankerl::nanobench::Bench().run(name + " churn - operator new", churn);
+
+    rttr::set_variant_allocator(rttr::get_default_variant_allocator());
+    rttr::reset_variant_allocator_stats();
+    std::cout << name << " pool: " << count_allocations(churn) << " allocs/iteration" << std::endl;
+    ankerl::nanobench::Bench().run(name + " churn - pool", churn);
+
+    const auto stats = rttr::get_variant_allocator_stats();
+    std::cout << name << " pool stats: " << stats.allocations << " allocations, "
+              << stats.deallocations << " deallocations, " << stats.pool_hits << " pool hits" << std::endl;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_variant_allocator()
+{
+    std::cout << "\n-- Variant allocator for heap-backed values --" << std::endl;
+
+    bench_variant_allocator_type("custom type", MyCustomType{});
+    bench_variant_allocator_type("payload_48", payload_48{});
+    bench_variant_allocator_type("std::string", std::string("a string which is too long for small string optimization"));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
 void bench_variant_create()
 {
     std::cout << "\n=== RTTR Variant Creation Benchmarks ===\n" << std::endl;
@@ -262,6 +379,9 @@ void bench_variant_create()
     bench_variant_int_dtor();
     bench_variant_bool_dtor();
     bench_variant_custom_dtor();
+
+    bench_variant_buffer_size();
+    bench_variant_allocator();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
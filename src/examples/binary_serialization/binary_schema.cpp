@@ -0,0 +1,151 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "binary_schema.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+using namespace rttr;
+
+namespace io
+{
+
+namespace
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void collect_object_types(const type& t, std::vector<type>& object_types)
+{
+    const auto& plan = serialization_plan::get(t);
+    switch (plan.get_kind())
+    {
+        case value_kind::object:
+        {
+            if (std::find(object_types.begin(), object_types.end(), t) != object_types.end())
+                return;
+
+            object_types.push_back(t);
+            for (const auto& field : plan.get_fields())
+                collect_object_types(field.value_type, object_types);
+            break;
+        }
+        case value_kind::sequential_container:
+        case value_kind::associative_container:
+        {
+            // the value types of a container are its leading template arguments
+            std::size_t index = 0;
+            const std::size_t value_type_count = (plan.get_kind() == value_kind::sequential_container ? 1 : 2);
+            for (const auto& arg : t.get_template_arguments())
+            {
+                if (index++ == value_type_count)
+                    break;
+                collect_object_types(arg, object_types);
+            }
+            break;
+        }
+        case value_kind::wrapper:
+        {
+            collect_object_types(t.get_wrapped_type(), object_types);
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+} // end namespace anonymous
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void write_binary_schema(binary_writer& writer, const type& root_type)
+{
+    std::vector<type> object_types;
+    collect_object_types(root_type, object_types);
+
+    writer.write_varint(object_types.size());
+    for (const auto& t : object_types)
+    {
+        const auto& fields = serialization_plan::get(t).get_fields();
+        writer.write_string(t.get_name().to_string());
+        writer.write_varint(fields.size());
+        for (const auto& field : fields)
+        {
+            writer.write_string(field.name);
+            writer.write_byte(static_cast<uint8_t>(field.kind));
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+binary_schema::binary_schema(binary_reader& reader)
+:   m_root_type(type::get<void>())
+{
+    const uint64_t type_count = reader.read_varint();
+    for (uint64_t type_index = 0; type_index < type_count; ++type_index)
+    {
+        const std::string type_name(reader.read_string());
+        const type t = type::get_by_name(type_name);
+        if (!t.is_valid())
+            throw std::runtime_error("the binary data contains the unknown type: " + type_name);
+
+        if (type_index == 0)
+            m_root_type = t;
+
+        const auto& plan = serialization_plan::get(t);
+        auto& fields = m_fields[t];
+        const uint64_t field_count = reader.read_varint();
+        for (uint64_t field_index = 0; field_index < field_count; ++field_index)
+        {
+            const std::string field_name(reader.read_string());
+            const auto kind = static_cast<value_kind>(reader.read_byte());
+            const field_op* field = plan.find_field(field_name);
+            if (!field || field->kind != kind)
+                throw std::runtime_error("the binary data does not match the property: " + type_name + "::" + field_name);
+
+            fields.push_back(field);
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+const std::vector<const field_op*>& binary_schema::get_fields(const type& t) const
+{
+    const auto itr = m_fields.find(t);
+    if (itr == m_fields.end())
+        throw std::runtime_error("the binary data contains no schema for the type: " + t.get_name().to_string());
+
+    return itr->second;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace io
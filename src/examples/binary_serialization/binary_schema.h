@@ -0,0 +1,80 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef BINARY_SCHEMA_H_
+#define BINARY_SCHEMA_H_
+
+#include <unordered_map>
+#include <vector>
+
+#include <rttr/type>
+
+#include "binary_stream.h"
+#include "serialization_plan.h"
+
+namespace io
+{
+
+/*!
+ * Writes the schema of all object types, which are reachable from the given type \p root_type.
+ *
+ * For every type its name and the names and kinds of its serializable properties are written;
+ * the index of a property in this list is its id. The objects itself contain only their values,
+ * in the order of the schema.
+ */
+void write_binary_schema(binary_writer& writer, const rttr::type& root_type);
+
+/*!
+ * The schema of a binary document, mapped to the local types.
+ */
+class binary_schema
+{
+public:
+    /*!
+     * Reads the schema written by \ref write_binary_schema() and maps every property id to the local property
+     * with the same name. Throws a `std::runtime_error`, when a type or property is unknown or has another kind.
+     */
+    explicit binary_schema(binary_reader& reader);
+
+    /*!
+     * Returns the type of the root object.
+     */
+    rttr::type get_root_type() const { return m_root_type; }
+
+    /*!
+     * Returns the local properties of type \p t, in the order in which they were written.
+     */
+    const std::vector<const field_op*>& get_fields(const rttr::type& t) const;
+
+private:
+    rttr::type                                                      m_root_type;
+    std::unordered_map<rttr::type, std::vector<const field_op*>>    m_fields;
+};
+
+} // end namespace io
+
+#endif // BINARY_SCHEMA_H_
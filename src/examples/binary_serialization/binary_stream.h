@@ -0,0 +1,243 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef BINARY_STREAM_H_
+#define BINARY_STREAM_H_
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace io
+{
+
+/*!
+ * The first bytes of every binary document.
+ */
+constexpr char binary_magic[4] = {'R', 'T', 'T', 'B'};
+
+/*!
+ * The layout of a binary document; it is stored after the magic bytes.
+ */
+enum class binary_format : uint8_t
+{
+    /*!
+     * A schema of all types is written in front of the data; the objects contain only their property values.
+     * The properties of the reading types have to match the schema.
+     */
+    compact     = 1,
+    /*!
+     * Every property value is prefixed with the id of the property, its kind and its length in bytes;
+     * a reader skips the properties it does not know, so properties can be added or removed between releases.
+     */
+    versioned   = 2
+};
+
+/*!
+ * Fixed size values are stored in the byte order of the writer; the reader refuses data with another byte order.
+ */
+constexpr uint8_t binary_byte_order = (std::endian::native == std::endian::little ? 1 : 2);
+
+/*!
+ * The encoding of a sequential container: element by element or as one block of raw bytes.
+ */
+enum class array_encoding : uint8_t
+{
+    elements,
+    block
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Appends binary encoded values to a growing byte buffer.
+ *
+ * Unsigned integers are stored as LEB128 varints, signed integers additionally zigzag encoded,
+ * floating point values and raw blocks with their fixed size.
+ */
+class binary_writer
+{
+public:
+    void write_byte(uint8_t value) { m_buffer.push_back(static_cast<char>(value)); }
+
+    void write_varint(uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            m_buffer.push_back(static_cast<char>((value & 0x7f) | 0x80));
+            value >>= 7;
+        }
+        m_buffer.push_back(static_cast<char>(value));
+    }
+
+    void write_signed_varint(int64_t value)
+    {
+        write_varint((static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+    }
+
+    template<typename T>
+    void write_fixed(T value)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "only trivially copyable types can be written as fixed value");
+        write_bytes(&value, sizeof(T));
+    }
+
+    void write_bytes(const void* data, std::size_t size) { m_buffer.append(static_cast<const char*>(data), size); }
+
+    void write_string(std::string_view text)
+    {
+        write_varint(text.size());
+        m_buffer.append(text.data(), text.size());
+    }
+
+    /*!
+     * Reserves a length prefix for the following bytes; call \ref end_length_prefix() with the returned position,
+     * after the bytes were written.
+     */
+    std::size_t begin_length_prefix()
+    {
+        m_buffer.push_back(0);
+        return m_buffer.size();
+    }
+
+    void end_length_prefix(std::size_t start)
+    {
+        uint64_t length = m_buffer.size() - start;
+        char prefix[10];
+        std::size_t prefix_size = 0;
+        while (length >= 0x80)
+        {
+            prefix[prefix_size++] = static_cast<char>((length & 0x7f) | 0x80);
+            length >>= 7;
+        }
+        prefix[prefix_size++] = static_cast<char>(length);
+
+        // one byte was reserved, which is enough for the most values; longer prefixes move the bytes behind
+        if (prefix_size > 1)
+            m_buffer.insert(start, prefix_size - 1, '\0');
+        std::memcpy(&m_buffer[start - 1], prefix, prefix_size);
+    }
+
+    std::string& get_buffer() { return m_buffer; }
+
+private:
+    std::string m_buffer;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Reads binary encoded values from a buffer, which is owned by the caller; e.g. a memory mapped file.
+ *
+ * Strings and raw blocks are returned as views into this buffer, so nothing is copied until the value
+ * is stored in its destination. A read behind the end of the buffer throws a `std::runtime_error`.
+ */
+class binary_reader
+{
+public:
+    explicit binary_reader(std::string_view data) : m_pos(data.data()), m_end(data.data() + data.size()) { }
+
+    uint8_t read_byte()
+    {
+        require(1);
+        return static_cast<uint8_t>(*m_pos++);
+    }
+
+    uint64_t read_varint()
+    {
+        uint64_t result = 0;
+        for (int shift = 0; shift < 64; shift += 7)
+        {
+            const uint8_t byte = read_byte();
+            result |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            if ((byte & 0x80) == 0)
+                return result;
+        }
+
+        throw std::runtime_error("invalid varint in binary data");
+    }
+
+    int64_t read_signed_varint()
+    {
+        const uint64_t value = read_varint();
+        return static_cast<int64_t>((value >> 1) ^ (~(value & 1) + 1));
+    }
+
+    template<typename T>
+    T read_fixed()
+    {
+        T value;
+        std::memcpy(&value, read_bytes(sizeof(T)).data(), sizeof(T));
+        return value;
+    }
+
+    std::string_view read_bytes(std::size_t size)
+    {
+        require(size);
+        std::string_view result(m_pos, size);
+        m_pos += size;
+        return result;
+    }
+
+    std::string_view read_string() { return read_bytes(static_cast<std::size_t>(read_varint())); }
+
+    /*!
+     * Reads the number of items of a container, whose every item needs at least \p item_size bytes;
+     * a count, for which the remaining bytes are not enough, throws a `std::runtime_error`.
+     * This is checked before the caller allocates anything for the items.
+     */
+    std::size_t read_count(std::size_t item_size)
+    {
+        const uint64_t count = read_varint();
+        if (item_size > 0 && count > get_remaining() / item_size)
+            throw std::runtime_error("invalid item count in binary data");
+
+        return static_cast<std::size_t>(count);
+    }
+
+    std::size_t get_remaining() const { return static_cast<std::size_t>(m_end - m_pos); }
+
+    bool at_end() const { return (m_pos == m_end); }
+
+private:
+    void require(std::size_t size) const
+    {
+        if (static_cast<std::size_t>(m_end - m_pos) < size)
+            throw std::runtime_error("unexpected end of binary data");
+    }
+
+    const char* m_pos;
+    const char* m_end;
+};
+
+} // end namespace io
+
+#endif // BINARY_STREAM_H_
@@ -0,0 +1,381 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <iostream>
+
+#include <rttr/type>
+
+#include "from_binary.h"
+#include "binary_schema.h"
+#include "binary_stream.h"
+#include "serialization_plan.h"
+
+using namespace rttr;
+using io::binary_format;
+using io::binary_reader;
+using io::binary_schema;
+using io::field_op;
+using io::serialization_plan;
+using io::value_kind;
+
+namespace
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void read_object(binary_reader& reader, const binary_schema* schema, instance obj, const type& t);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void read_value(binary_reader& reader, const binary_schema* schema, value_kind kind, const type& t, variant& var);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant read_basic_value(binary_reader& reader, value_kind kind)
+{
+    switch (kind)
+    {
+        case value_kind::boolean:   return (reader.read_byte() != 0);
+        case value_kind::character: return reader.read_fixed<char>();
+        case value_kind::int8:      return reader.read_fixed<int8_t>();
+        case value_kind::int16:     return static_cast<int16_t>(reader.read_signed_varint());
+        case value_kind::int32:     return static_cast<int32_t>(reader.read_signed_varint());
+        case value_kind::int64:     return reader.read_signed_varint();
+        case value_kind::uint8:     return reader.read_fixed<uint8_t>();
+        case value_kind::uint16:    return static_cast<uint16_t>(reader.read_varint());
+        case value_kind::uint32:    return static_cast<uint32_t>(reader.read_varint());
+        case value_kind::uint64:    return reader.read_varint();
+        case value_kind::float32:   return reader.read_fixed<float>();
+        case value_kind::float64:   return reader.read_fixed<double>();
+        case value_kind::string:    return std::string(reader.read_string());
+        default:                    return variant();
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+void read_block(binary_reader& reader, variant& var)
+{
+    const std::size_t count = reader.read_count(sizeof(T));
+    const std::string_view bytes = reader.read_bytes(count * sizeof(T));
+
+    if (var.is_type<std::vector<T>>())
+    {
+        std::vector<T> values(count);
+        std::memcpy(values.data(), bytes.data(), bytes.size());
+        var = std::move(values);
+    }
+    else
+    {
+        // the local container has no contiguous storage, the values are copied one by one
+        auto view = var.create_sequential_view();
+        view.set_size(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            T value;
+            std::memcpy(&value, bytes.data() + i * sizeof(T), sizeof(T));
+            view.set_value(i, value);
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void read_array_block(binary_reader& reader, value_kind item_kind, variant& var)
+{
+    switch (item_kind)
+    {
+        case value_kind::character: return read_block<char>(reader, var);
+        case value_kind::int8:      return read_block<int8_t>(reader, var);
+        case value_kind::int16:     return read_block<int16_t>(reader, var);
+        case value_kind::int32:     return read_block<int32_t>(reader, var);
+        case value_kind::int64:     return read_block<int64_t>(reader, var);
+        case value_kind::uint8:     return read_block<uint8_t>(reader, var);
+        case value_kind::uint16:    return read_block<uint16_t>(reader, var);
+        case value_kind::uint32:    return read_block<uint32_t>(reader, var);
+        case value_kind::uint64:    return read_block<uint64_t>(reader, var);
+        case value_kind::float32:   return read_block<float>(reader, var);
+        case value_kind::float64:   return read_block<double>(reader, var);
+        default:                    throw std::runtime_error("invalid block of values in binary data");
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Objects without serializable properties are stored without any byte in the compact layout,
+ * so the count of such items cannot be checked against the remaining bytes; it is limited to this value.
+ */
+constexpr std::size_t max_empty_item_count = 1 << 16;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Returns the minimal number of bytes of a stored value of type \p t; this is one byte,
+ * except for an object without serializable properties in the compact layout.
+ */
+std::size_t get_min_value_size(const binary_schema* schema, value_kind kind, const type& t)
+{
+    if (kind == value_kind::object && schema && schema->get_fields(t).empty())
+        return 0;
+
+    return 1;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Reads the number of items of a container, whose items need at least \p item_size bytes.
+ */
+std::size_t read_item_count(binary_reader& reader, std::size_t item_size)
+{
+    const std::size_t count = reader.read_count(item_size);
+    if (item_size == 0 && count > max_empty_item_count)
+        throw std::runtime_error("too many empty objects in binary data");
+
+    return count;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void read_array(binary_reader& reader, const binary_schema* schema, variant& var)
+{
+    auto view = var.create_sequential_view();
+    const type item_type = view.get_value_type();
+    const value_kind item_kind = serialization_plan::get(item_type).get_kind();
+
+    if (static_cast<io::array_encoding>(reader.read_byte()) == io::array_encoding::block)
+        return read_array_block(reader, item_kind, var);
+
+    const std::size_t count = read_item_count(reader, get_min_value_size(schema, item_kind, item_type));
+    view.set_size(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        variant item = view.get_value(i).extract_wrapped_value();
+        read_value(reader, schema, item_kind, item_type, item);
+        view.set_value(i, item);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Returns a new value of type \p t, which is filled by \ref read_value().
+ */
+variant create_value(value_kind kind, const type& t)
+{
+    if (io::is_basic_kind(kind) || kind == value_kind::enumeration)
+        return variant();
+
+    variant var = t.create();
+    if (var.get_type() != t && var.get_type().is_wrapper())
+        var = var.extract_wrapped_value();
+
+    if (!var.is_valid())
+        throw std::runtime_error("cannot create a value of type: " + t.get_name().to_string());
+
+    return var;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void read_associative_container(binary_reader& reader, const binary_schema* schema, variant& var)
+{
+    auto view = var.create_associative_view();
+    const type key_type = view.get_key_type();
+    const value_kind key_kind = serialization_plan::get(key_type).get_kind();
+
+    view.clear();
+    const std::size_t key_size = get_min_value_size(schema, key_kind, key_type);
+    if (view.is_key_only_type())
+    {
+        const std::size_t count = read_item_count(reader, key_size);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            variant key = create_value(key_kind, key_type);
+            read_value(reader, schema, key_kind, key_type, key);
+            view.insert(key);
+        }
+    }
+    else
+    {
+        const type mapped_type = view.get_value_type();
+        const value_kind mapped_kind = serialization_plan::get(mapped_type).get_kind();
+        const std::size_t count = read_item_count(reader, key_size + get_min_value_size(schema, mapped_kind, mapped_type));
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            variant key = create_value(key_kind, key_type);
+            read_value(reader, schema, key_kind, key_type, key);
+            variant value = create_value(mapped_kind, mapped_type);
+            read_value(reader, schema, mapped_kind, mapped_type, value);
+            view.insert(key, value);
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void read_value(binary_reader& reader, const binary_schema* schema, value_kind kind, const type& t, variant& var)
+{
+    if (io::is_basic_kind(kind))
+    {
+        var = read_basic_value(reader, kind);
+        return;
+    }
+
+    switch (kind)
+    {
+        case value_kind::enumeration:
+        {
+            var = reader.read_signed_varint();
+            if (!var.convert(t))
+                throw std::runtime_error("invalid enumeration value for type: " + t.get_name().to_string());
+            break;
+        }
+        case value_kind::sequential_container:  return read_array(reader, schema, var);
+        case value_kind::associative_container: return read_associative_container(reader, schema, var);
+        case value_kind::wrapper:
+        {
+            if (reader.read_byte() == 0)
+                return; // the wrapper was empty
+
+            // the wrapped object is filled in place; a wrapper which holds no object cannot be filled
+            const type wrapped_type = t.get_wrapped_type();
+            if (!var.extract_wrapped_value().is_valid())
+                throw std::runtime_error("cannot read into the empty wrapper: " + t.get_name().to_string());
+
+            const instance obj = var;
+            return read_object(reader, schema, obj.get_wrapped_instance(), wrapped_type);
+        }
+        default:                                return read_object(reader, schema, var, t);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void read_field(binary_reader& reader, const binary_schema* schema, const field_op& field, instance& obj)
+{
+    variant var;
+    if (!io::is_basic_kind(field.kind) && field.kind != value_kind::enumeration)
+        var = field.accessor.get_value(obj); // objects and containers are filled in place
+
+    read_value(reader, schema, field.kind, field.value_type, var);
+    field.accessor.set_value(obj, var);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void read_versioned_object(binary_reader& reader, instance obj, const type& t)
+{
+    const auto& plan = serialization_plan::get(t);
+    const uint64_t field_count = reader.read_varint();
+    for (uint64_t i = 0; i < field_count; ++i)
+    {
+        const uint32_t id = reader.read_fixed<uint32_t>();
+        const auto kind = static_cast<value_kind>(reader.read_byte());
+        binary_reader field_reader(reader.read_bytes(static_cast<std::size_t>(reader.read_varint())));
+
+        const field_op* field = plan.find_field(id);
+        if (!field || field->kind != kind)
+            continue; // the property was removed or its type has changed; its bytes are skipped
+
+        read_field(field_reader, nullptr, *field, obj);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Reads the properties of an object of type \p t; without a \p schema the data has the versioned layout.
+ */
+void read_object(binary_reader& reader, const binary_schema* schema, instance obj, const type& t)
+{
+    if (!schema)
+        return read_versioned_object(reader, obj, t);
+
+    for (const auto* field : schema->get_fields(t))
+        read_field(reader, schema, *field, obj);
+}
+
+} // end namespace anonymous
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+namespace io
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool from_binary(std::string_view data, rttr::instance obj2)
+{
+    if (!obj2.is_valid())
+        return false;
+
+    try
+    {
+        binary_reader reader(data);
+        if (reader.read_bytes(sizeof(binary_magic)) != std::string_view(binary_magic, sizeof(binary_magic)))
+            throw std::runtime_error("the data is no binary document");
+        const auto format = static_cast<binary_format>(reader.read_byte());
+        if (format != binary_format::compact && format != binary_format::versioned)
+            throw std::runtime_error("unsupported layout of the binary format");
+        if (reader.read_byte() != binary_byte_order)
+            throw std::runtime_error("the binary data was written with another byte order");
+
+        instance obj = obj2.get_type().get_raw_type().is_wrapper() ? obj2.get_wrapped_instance() : obj2;
+        if (format == binary_format::versioned)
+        {
+            read_versioned_object(reader, obj, obj.get_derived_type());
+            return true;
+        }
+
+        const binary_schema schema(reader);
+        if (!obj.get_derived_type().is_derived_from(schema.get_root_type()))
+            throw std::runtime_error("the binary data contains an object of type: " + schema.get_root_type().get_name().to_string());
+
+        read_object(reader, &schema, obj, schema.get_root_type());
+        return true;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "binary parsing error: " << e.what() << std::endl;
+        return false;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace io
@@ -0,0 +1,197 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <map>
+#include <iostream>
+
+#include <rttr/registration>
+
+#include "to_binary.h"
+#include "from_binary.h"
+
+using namespace rttr;
+
+enum class color
+{
+    red,
+    green,
+    blue
+};
+
+struct point2d
+{
+    point2d() {}
+    point2d(int x_, int y_) : x(x_), y(y_) {}
+    int x = 0;
+    int y = 0;
+};
+
+struct shape
+{
+    shape(std::string n) : name(n) {}
+
+    void set_visible(bool v) { visible = v; }
+    bool get_visible() const { return visible; }
+
+    color color_ = color::blue;
+    std::string name = "";
+    point2d position;
+    std::map<color, point2d> dictionary;
+
+    RTTR_ENABLE()
+private:
+    bool visible = false;
+};
+
+struct circle : shape
+{
+    circle(std::string n) : shape(n) {}
+
+    double radius = 5.2;
+    std::vector<point2d> points;
+    std::vector<double> samples;
+
+    int no_serialize = 100;
+
+    RTTR_ENABLE(shape)
+};
+
+RTTR_REGISTRATION
+{
+    rttr::registration::class_<shape>("shape")
+        .property("visible", &shape::get_visible, &shape::set_visible)
+        .property("color", &shape::color_)
+        .property("name", &shape::name)
+        .property("position", &shape::position)
+        .property("dictionary", &shape::dictionary)
+    ;
+
+    rttr::registration::class_<circle>("circle")
+        .property("radius", &circle::radius)
+        .property("points", &circle::points)
+        .property("samples", &circle::samples)
+        .property("no_serialize", &circle::no_serialize)
+        (
+            metadata("NO_SERIALIZE", true)
+        )
+        ;
+
+    rttr::registration::class_<point2d>("point2d")
+        .constructor()(rttr::policy::ctor::as_object)
+        .property("x", &point2d::x)
+        .property("y", &point2d::y)
+        ;
+
+
+    rttr::registration::enumeration<color>("color")
+        (
+            value("red", color::red),
+            value("blue", color::blue),
+            value("green", color::green)
+        );
+}
+
+static void print_circle(const circle& c)
+{
+    std::cout << "name: " << c.name << ", visible: " << std::boolalpha << c.get_visible()
+              << ", color: " << type::get<color>().get_enumeration().value_to_name(c.color_)
+              << ", position: (" << c.position.x << ", " << c.position.y << ")"
+              << ", radius: " << c.radius << std::endl;
+
+    std::cout << "points:";
+    for (const auto& p : c.points)
+        std::cout << " (" << p.x << ", " << p.y << ")";
+
+    std::cout << "\nsamples:";
+    for (const auto& value : c.samples)
+        std::cout << " " << value;
+
+    std::cout << "\ndictionary:";
+    for (const auto& item : c.dictionary)
+        std::cout << " " << type::get<color>().get_enumeration().value_to_name(item.first) << " => (" << item.second.x << ", " << item.second.y << ")";
+
+    std::cout << "\nno_serialize: " << c.no_serialize << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    std::string binary_data;
+
+    {
+        circle c_1("Circle #1");
+        shape& my_shape = c_1;
+
+        c_1.set_visible(true);
+        c_1.points = std::vector<point2d>(2, point2d(1, 1));
+        c_1.points[1].x = 23;
+        c_1.points[1].y = 42;
+        c_1.samples = { 0.5, 1.25, 2.0, 4.75 };
+
+        c_1.position.x = 12;
+        c_1.position.y = 66;
+
+        c_1.radius = 5.123;
+        c_1.color_ = color::red;
+
+        c_1.dictionary = { { {color::green, {1, 2} }, {color::blue, {3, 4} }, {color::red, {5, 6} } } };
+
+        c_1.no_serialize = 12345;
+
+        binary_data = io::to_binary(my_shape); // serialize the circle to 'binary_data'
+
+        std::cout << "Circle c_1:\n";
+        print_circle(c_1);
+    }
+
+    std::cout << "\n" << binary_data.size() << " bytes of binary data" << std::endl;
+
+    circle c_2("Circle #2"); // create a new empty circle
+
+    // the data is read in place; it could also be a memory mapped file
+    io::from_binary(binary_data, c_2); // deserialize it with the content of 'c_1'
+    std::cout << "\n############################################\n" << std::endl;
+
+    std::cout << "Circle c_2:\n";
+    print_circle(c_2);
+
+    // the versioned layout stores the id, kind and length of every property;
+    // readers skip the properties which they do not know
+    const std::string versioned_data = io::to_binary(c_2, io::binary_format::versioned);
+    std::cout << "\n" << versioned_data.size() << " bytes of versioned binary data" << std::endl;
+
+    circle c_3("Circle #3");
+    io::from_binary(versioned_data, c_3);
+    std::cout << "\n############################################\n" << std::endl;
+
+    std::cout << "Circle c_3:\n";
+    print_circle(c_3);
+
+    return 0;
+}
@@ -0,0 +1,279 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <iostream>
+
+#include <rttr/type>
+
+#include "to_binary.h"
+#include "binary_schema.h"
+#include "binary_stream.h"
+#include "serialization_plan.h"
+
+using namespace rttr;
+using io::binary_format;
+using io::binary_writer;
+using io::serialization_plan;
+using io::value_kind;
+
+
+namespace
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void write_object(binary_writer& writer, binary_format format, const instance& obj, const type& t);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void write_value(binary_writer& writer, binary_format format, value_kind kind, const type& t, const variant& var);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+T get_basic_value(const variant& var)
+{
+    if (var.is_type<T>())
+        return var.get_value<T>();
+    else
+        return var.convert<T>();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void write_basic_value(binary_writer& writer, value_kind kind, const variant& var)
+{
+    switch (kind)
+    {
+        case value_kind::boolean:   return writer.write_byte(get_basic_value<bool>(var) ? 1 : 0);
+        case value_kind::character: return writer.write_fixed(get_basic_value<char>(var));
+        case value_kind::int8:      return writer.write_fixed(get_basic_value<int8_t>(var));
+        case value_kind::int16:     return writer.write_signed_varint(get_basic_value<int16_t>(var));
+        case value_kind::int32:     return writer.write_signed_varint(get_basic_value<int32_t>(var));
+        case value_kind::int64:     return writer.write_signed_varint(get_basic_value<int64_t>(var));
+        case value_kind::uint8:     return writer.write_fixed(get_basic_value<uint8_t>(var));
+        case value_kind::uint16:    return writer.write_varint(get_basic_value<uint16_t>(var));
+        case value_kind::uint32:    return writer.write_varint(get_basic_value<uint32_t>(var));
+        case value_kind::uint64:    return writer.write_varint(get_basic_value<uint64_t>(var));
+        case value_kind::float32:   return writer.write_fixed(get_basic_value<float>(var));
+        case value_kind::float64:   return writer.write_fixed(get_basic_value<double>(var));
+        case value_kind::string:
+        {
+            if (var.is_type<std::string>())
+                return writer.write_string(var.get_value<std::string>());
+            else
+                return writer.write_string(var.to_string());
+        }
+        default:                    return;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+bool write_block(binary_writer& writer, const variant& var)
+{
+    if (!var.is_type<std::vector<T>>())
+        return false;
+
+    const auto& values = var.get_value<std::vector<T>>();
+    writer.write_byte(static_cast<uint8_t>(io::array_encoding::block));
+    writer.write_varint(values.size());
+    writer.write_bytes(values.data(), values.size() * sizeof(T));
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Writes a `std::vector` of arithmetic values with a single copy of its contiguous storage.
+ * Returns false, when the container has to be written element by element.
+ */
+bool write_array_block(binary_writer& writer, value_kind item_kind, const variant& var)
+{
+    switch (item_kind)
+    {
+        case value_kind::character: return write_block<char>(writer, var);
+        case value_kind::int8:      return write_block<int8_t>(writer, var);
+        case value_kind::int16:     return write_block<int16_t>(writer, var);
+        case value_kind::int32:     return write_block<int32_t>(writer, var);
+        case value_kind::int64:     return write_block<int64_t>(writer, var);
+        case value_kind::uint8:     return write_block<uint8_t>(writer, var);
+        case value_kind::uint16:    return write_block<uint16_t>(writer, var);
+        case value_kind::uint32:    return write_block<uint32_t>(writer, var);
+        case value_kind::uint64:    return write_block<uint64_t>(writer, var);
+        case value_kind::float32:   return write_block<float>(writer, var);
+        case value_kind::float64:   return write_block<double>(writer, var);
+        default:                    return false; // std::vector<bool> has no contiguous storage
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void write_array(binary_writer& writer, binary_format format, const variant& var)
+{
+    const variant_sequential_view view = var.create_sequential_view();
+    const type item_type = view.get_value_type();
+    const value_kind item_kind = serialization_plan::get(item_type).get_kind();
+
+    if (write_array_block(writer, item_kind, var))
+        return;
+
+    writer.write_byte(static_cast<uint8_t>(io::array_encoding::elements));
+    writer.write_varint(view.get_size());
+    for (const auto& item : view)
+        write_value(writer, format, item_kind, item_type, item.extract_wrapped_value());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void write_associative_container(binary_writer& writer, binary_format format, const variant& var)
+{
+    const variant_associative_view view = var.create_associative_view();
+    const type key_type = view.get_key_type();
+    const value_kind key_kind = serialization_plan::get(key_type).get_kind();
+
+    writer.write_varint(view.get_size());
+    if (view.is_key_only_type())
+    {
+        for (auto& item : view)
+            write_value(writer, format, key_kind, key_type, item.first.extract_wrapped_value());
+    }
+    else
+    {
+        const type mapped_type = view.get_value_type();
+        const value_kind mapped_kind = serialization_plan::get(mapped_type).get_kind();
+        for (auto& item : view)
+        {
+            write_value(writer, format, key_kind, key_type, item.first.extract_wrapped_value());
+            write_value(writer, format, mapped_kind, mapped_type, item.second.extract_wrapped_value());
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void write_value(binary_writer& writer, binary_format format, value_kind kind, const type& t, const variant& var)
+{
+    if (io::is_basic_kind(kind))
+        return write_basic_value(writer, kind, var);
+
+    switch (kind)
+    {
+        case value_kind::enumeration:           return writer.write_signed_varint(var.to_int64());
+        case value_kind::sequential_container:  return write_array(writer, format, var);
+        case value_kind::associative_container: return write_associative_container(writer, format, var);
+        case value_kind::wrapper:
+        {
+            const variant wrapped_var = var.extract_wrapped_value();
+            writer.write_byte(wrapped_var.is_valid() ? 1 : 0);
+            if (!wrapped_var.is_valid())
+                return; // e.g. an empty smart pointer
+
+            const type wrapped_type = t.get_wrapped_type();
+            return write_value(writer, format, serialization_plan::get(wrapped_type).get_kind(), wrapped_type, wrapped_var);
+        }
+        default:                                return write_object(writer, format, var, t);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void write_object(binary_writer& writer, binary_format format, const instance& obj, const type& t)
+{
+    const auto& fields = serialization_plan::get(t).get_fields();
+    if (format == binary_format::versioned)
+        writer.write_varint(fields.size());
+
+    for (const auto& field : fields)
+    {
+        const variant prop_value = field.accessor.get_value(obj);
+        if (!prop_value)
+            throw std::runtime_error("cannot retrieve the value of the property: " + field.name);
+
+        if (format == binary_format::versioned)
+        {
+            writer.write_fixed(field.id);
+            writer.write_byte(static_cast<uint8_t>(field.kind));
+            const std::size_t start = writer.begin_length_prefix();
+            write_value(writer, format, field.kind, field.value_type, prop_value);
+            writer.end_length_prefix(start);
+        }
+        else
+        {
+            write_value(writer, format, field.kind, field.value_type, prop_value);
+        }
+    }
+}
+
+} // end namespace anonymous
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+namespace io
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::string to_binary(rttr::instance obj2, binary_format format)
+{
+    if (!obj2.is_valid())
+        return std::string();
+
+    instance obj = obj2.get_type().get_raw_type().is_wrapper() ? obj2.get_wrapped_instance() : obj2;
+    const type root_type = obj.get_derived_type();
+
+    binary_writer writer;
+    writer.write_bytes(binary_magic, sizeof(binary_magic));
+    writer.write_byte(static_cast<uint8_t>(format));
+    writer.write_byte(binary_byte_order);
+    if (format == binary_format::compact)
+        write_binary_schema(writer, root_type);
+
+    try
+    {
+        write_object(writer, format, obj, root_type);
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "cannot serialize to binary: " << e.what() << std::endl;
+        return std::string();
+    }
+
+    return std::move(writer.get_buffer());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace io
@@ -32,5 +32,7 @@ set(HEADER_FILES to_json.h
 
 set(SOURCE_FILES main.cpp
                  to_json.cpp
+                 to_json_stream.cpp
                  from_json.cpp
+                 from_json_stream.cpp
                  )
@@ -23,7 +23,7 @@
 *   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
 *   SOFTWARE.                                                                       *
 *                                                                                   *
-************************************************************************************/
+*************************************************************************************/
 
 #include <cstdio>
 #include <string>
@@ -35,8 +35,12 @@
 #include <nlohmann/json.hpp>
 #include <rttr/type>
 
+#include "serialization_plan.h"
+
 using json = nlohmann::json;
 using namespace rttr;
+using io::serialization_plan;
+using io::value_kind;
 
 namespace
 {
@@ -65,10 +69,49 @@ variant extract_basic_types(const json& json_value)
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+variant extract_value(const json& json_value, value_kind kind, const type& t)
+{
+    switch (kind)
+    {
+        case value_kind::boolean:   return json_value.get<bool>();
+        case value_kind::character: return static_cast<char>(json_value.get<int>());
+        case value_kind::int8:      return json_value.get<int8_t>();
+        case value_kind::int16:     return json_value.get<int16_t>();
+        case value_kind::int32:     return json_value.get<int32_t>();
+        case value_kind::int64:     return json_value.get<int64_t>();
+        case value_kind::uint8:     return json_value.get<uint8_t>();
+        case value_kind::uint16:    return json_value.get<uint16_t>();
+        case value_kind::uint32:    return json_value.get<uint32_t>();
+        case value_kind::uint64:    return json_value.get<uint64_t>();
+        case value_kind::float32:   return json_value.get<float>();
+        case value_kind::float64:   return json_value.get<double>();
+        case value_kind::string:    return json_value.get<std::string>();
+        case value_kind::enumeration:
+        {
+            if (json_value.is_string())
+                return t.get_enumeration().name_to_value(json_value.get<std::string>());
+            else if (json_value.is_number_integer())
+                return t.get_enumeration().value_to_name(json_value.get<int64_t>());
+
+            return variant();
+        }
+        case value_kind::wrapper:
+        {
+            const type wrapped_type = t.get_wrapped_type();
+            return extract_value(json_value, serialization_plan::get(wrapped_type).get_kind(), wrapped_type);
+        }
+        default:
+            return extract_basic_types(json_value);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 static void write_array_recursively(variant_sequential_view& view, const json& json_array_value)
 {
     view.set_size(json_array_value.size());
     const type array_value_type = view.get_value_type();
+    const value_kind item_kind = serialization_plan::get(array_value_type).get_kind();
 
     for (size_t i = 0; i < json_array_value.size(); ++i)
     {
@@ -87,7 +130,7 @@ static void write_array_recursively(variant_sequential_view& view, const json& j
         }
         else
         {
-            variant extracted_value = extract_basic_types(json_index_value);
+            variant extracted_value = extract_value(json_index_value, item_kind, array_value_type);
             if (extracted_value.convert(array_value_type))
                 view.set_value(i, extracted_value);
         }
@@ -96,99 +139,123 @@ static void write_array_recursively(variant_sequential_view& view, const json& j
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-variant extract_value(const json& json_value, const type& t)
+/*!
+ * Returns the key or the value of an associative container; objects and arrays are created with their type \p t.
+ */
+variant extract_associative_value(const json& json_value, const type& t)
 {
-    if (t.is_arithmetic())
+    const value_kind kind = serialization_plan::get(t).get_kind();
+    if (json_value.is_object() || (json_value.is_array() && kind == value_kind::sequential_container))
     {
-        if (t == type::get<bool>())
-            return json_value.get<bool>();
-        else if (t == type::get<char>())
-            return static_cast<char>(json_value.get<int>());
-        else if (t == type::get<int8_t>())
-            return json_value.get<int8_t>();
-        else if (t == type::get<int16_t>())
-            return json_value.get<int16_t>();
-        else if (t == type::get<int32_t>())
-            return json_value.get<int32_t>();
-        else if (t == type::get<int64_t>())
-            return json_value.get<int64_t>();
-        else if (t == type::get<uint8_t>())
-            return json_value.get<uint8_t>();
-        else if (t == type::get<uint16_t>())
-            return json_value.get<uint16_t>();
-        else if (t == type::get<uint32_t>())
-            return json_value.get<uint32_t>();
-        else if (t == type::get<uint64_t>())
-            return json_value.get<uint64_t>();
-        else if (t == type::get<float>())
-            return json_value.get<float>();
-        else if (t == type::get<double>())
-            return json_value.get<double>();
-    }
-    else if (t.is_enumeration())
-    {
-        if (json_value.is_string())
+        variant var = t.create();
+        if (var.get_type() != t && var.get_type().is_wrapper())
+            var = var.extract_wrapped_value();
+
+        if (!var)
+            return variant();
+
+        if (json_value.is_object())
         {
-            return t.get_enumeration().name_to_value(json_value.get<std::string>());
+            fromjson_recursively(var, json_value);
         }
-        else if (json_value.is_number_integer())
+        else
         {
-            return t.get_enumeration().value_to_name(json_value.get<int64_t>());
+            auto view = var.create_sequential_view();
+            write_array_recursively(view, json_value);
         }
-    }
-    else if (t == type::get<std::string>())
-    {
-        return json_value.get<std::string>();
+        return var;
     }
 
-    return variant();
+    variant extracted_value = extract_value(json_value, kind, t);
+    if (!extracted_value.convert(t))
+        return variant();
+
+    return extracted_value;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-void fromjson_recursively(instance obj, const json& json_object)
+/*!
+ * Reads the array written by \ref io::to_json(): the keys of a set,
+ * or one object with the members `"key"` and `"value"` for every entry of a map.
+ */
+static void write_associative_view_recursively(variant_associative_view& view, const json& json_array_value)
 {
-    instance wrapped_obj = obj.get_type().get_raw_type().is_wrapper() ? obj.get_wrapped_instance() : obj;
-    const auto prop_list = wrapped_obj.get_derived_type().get_properties();
+    view.clear();
+    const type key_type = view.get_key_type();
 
-    for (auto prop : prop_list)
+    for (const auto& json_index_value : json_array_value)
     {
-        if (prop.get_metadata("NO_SERIALIZE"))
+        if (view.is_key_only_type())
+        {
+            variant key = extract_associative_value(json_index_value, key_type);
+            if (key)
+                view.insert(key);
             continue;
+        }
 
-        const auto name = prop.get_name();
-        if (!json_object.contains(name.data()))
+        if (!json_index_value.is_object())
             continue;
 
-        const json& json_value = json_object[name.data()];
-        const type value_t = prop.get_type();
+        const auto key_itr = json_index_value.find("key");
+        const auto value_itr = json_index_value.find("value");
+        if (key_itr == json_index_value.end() || value_itr == json_index_value.end())
+            continue;
 
+        variant key = extract_associative_value(*key_itr, key_type);
+        variant value = extract_associative_value(*value_itr, view.get_value_type());
+        if (key && value)
+            view.insert(key, value);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void fromjson_recursively(instance obj, const json& json_object)
+{
+    instance wrapped_obj = obj.get_type().get_raw_type().is_wrapper() ? obj.get_wrapped_instance() : obj;
+    const auto& plan = serialization_plan::get(wrapped_obj.get_derived_type());
+
+    for (const auto& field : plan.get_fields())
+    {
+        const auto itr = json_object.find(field.name);
+        if (itr == json_object.end())
+            continue;
+
+        const json& json_value = *itr;
         switch (json_value.type())
         {
             case json::value_t::array:
             {
-                variant var;
-                if (value_t.is_sequential_container())
+                if (field.kind == value_kind::sequential_container)
                 {
-                    var = prop.get_value(wrapped_obj);
+                    variant var = field.accessor.get_value(wrapped_obj);
                     auto view = var.create_sequential_view();
                     write_array_recursively(view, json_value);
+                    field.accessor.set_value(wrapped_obj, var);
+                }
+                else if (field.kind == value_kind::associative_container)
+                {
+                    variant var = field.accessor.get_value(wrapped_obj);
+                    auto view = var.create_associative_view();
+                    write_associative_view_recursively(view, json_value);
+                    field.accessor.set_value(wrapped_obj, var);
                 }
                 break;
             }
             case json::value_t::object:
             {
-                variant var = prop.get_value(wrapped_obj);
+                variant var = field.accessor.get_value(wrapped_obj);
                 fromjson_recursively(var, json_value);
-                prop.set_value(wrapped_obj, var);
+                field.accessor.set_value(wrapped_obj, var);
                 break;
             }
             default:
             {
-                variant extracted_value = extract_value(json_value, value_t.is_wrapper() ? value_t.get_wrapped_type() : value_t);
-                if (extracted_value.convert(value_t))
+                variant extracted_value = extract_value(json_value, field.kind, field.value_type);
+                if (extracted_value.convert(field.value_type))
                 {
-                    prop.set_value(wrapped_obj, extracted_value);
+                    field.accessor.set_value(wrapped_obj, extracted_value);
                 }
             }
         }
@@ -223,4 +290,4 @@ bool from_json(const std::string& json_str, rttr::instance obj)
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-} // end namespace io
\ No newline at end of file
+} // end namespace io
@@ -25,6 +25,7 @@
 *                                                                                   *
 *************************************************************************************/
 
+#include <istream>
 #include <string>
 #include <rttr/type>
 
@@ -35,5 +36,13 @@ namespace io
  */
 bool from_json(const std::string& json, rttr::instance obj);
 
+/*!
+ * Deserialize the json text read from the given stream \p in to the given instance \p obj.
+ *
+ * The text is parsed with SAX events, which fill the object graph directly;
+ * no json document is created in memory.
+ */
+bool from_json(std::istream& in, rttr::instance obj);
+
 }
 
@@ -0,0 +1,446 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <deque>
+#include <string>
+
+#include <iostream>
+
+#include <nlohmann/json.hpp>
+#include <rttr/type>
+
+#include "from_json.h"
+#include "serialization_plan.h"
+
+using json = nlohmann::json;
+using namespace rttr;
+using io::field_op;
+using io::serialization_plan;
+using io::value_kind;
+
+namespace
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool convert_value(variant& var, value_kind kind, const type& t)
+{
+    switch (kind)
+    {
+        case value_kind::enumeration:
+        {
+            if (var.is_type<std::string>())
+                var = t.get_enumeration().name_to_value(var.get_value<std::string>());
+
+            return var.convert(t);
+        }
+        case value_kind::wrapper:
+        {
+            const type wrapped_type = t.get_wrapped_type();
+            return (convert_value(var, serialization_plan::get(wrapped_type).get_kind(), wrapped_type) && var.convert(t));
+        }
+        default:
+            return var.convert(t);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Returns a new value of type \p t, which is filled by a frame; e.g. the key or the value of a map entry.
+ */
+variant create_value(const type& t)
+{
+    variant var = t.create();
+    if (var.get_type() != t && var.get_type().is_wrapper())
+        var = var.extract_wrapped_value();
+
+    return var;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Fills an object graph from the SAX events of the json parser.
+ *
+ * Every open json object or array, which is mapped to a property, has its own frame;
+ * the value of a frame is a copy of the property value and is written back when the frame is closed.
+ * An associative container is read from the array written by \ref io::to_json(): the keys of a set,
+ * or one object with the members `"key"` and `"value"` for every entry of a map.
+ * Properties, which cannot be found in the serialization plan of the type, are skipped.
+ */
+class json_object_reader : public nlohmann::json_sax<json>
+{
+public:
+    explicit json_object_reader(instance obj) : m_root(obj) { }
+
+    bool null() override { return set_value(variant()); }
+    bool boolean(bool val) override { return set_value(val); }
+    bool number_integer(number_integer_t val) override { return set_value(val); }
+    bool number_unsigned(number_unsigned_t val) override { return set_value(val); }
+    bool number_float(number_float_t val, const string_t&) override { return set_value(val); }
+    bool string(string_t& val) override { return set_value(std::move(val)); }
+    bool binary(binary_t&) override { return true; }
+
+    bool start_object(std::size_t) override
+    {
+        if (m_frames.empty())
+        {
+            m_frames.emplace_back(m_root);
+            return true;
+        }
+
+        auto& parent = m_frames.back();
+        if (parent.kind == frame_kind::skip)
+            ++parent.skip_depth;
+        else if (!open_child(frame_kind::object))
+            m_frames.emplace_back(frame_kind::skip);
+
+        return true;
+    }
+
+    bool key(string_t& val) override
+    {
+        auto& current = m_frames.back();
+        if (current.kind == frame_kind::object)
+            current.field = current.plan->find_field(val);
+        else if (current.kind == frame_kind::map_entry)
+            current.slot = (val == "key" ? entry_slot::key : (val == "value" ? entry_slot::value : entry_slot::none));
+
+        return true;
+    }
+
+    bool end_object() override { return close_frame(); }
+
+    bool start_array(std::size_t) override
+    {
+        if (m_frames.empty())
+        {
+            m_frames.emplace_back(frame_kind::skip); // the root has to be an object
+            return true;
+        }
+
+        auto& parent = m_frames.back();
+        if (parent.kind == frame_kind::skip)
+            ++parent.skip_depth;
+        else if (!open_child(frame_kind::array))
+            m_frames.emplace_back(frame_kind::skip);
+
+        return true;
+    }
+
+    bool end_array() override { return close_frame(); }
+
+    bool parse_error(std::size_t, const std::string&, const nlohmann::detail::exception& ex) override
+    {
+        std::cerr << "JSON parsing error: " << ex.what() << std::endl;
+        return false;
+    }
+
+private:
+    enum class frame_kind
+    {
+        object,
+        array,
+        map,
+        map_entry,
+        skip
+    };
+
+    //! The member of a map entry, which is read next
+    enum class entry_slot
+    {
+        none,
+        key,
+        value
+    };
+
+    static instance get_object(instance obj)
+    {
+        return (obj.get_type().get_raw_type().is_wrapper() ? obj.get_wrapped_instance() : obj);
+    }
+
+    struct frame
+    {
+        explicit frame(frame_kind k) : kind(k) { }
+
+        explicit frame(instance root)
+        :   kind(frame_kind::object),
+            obj(get_object(root)),
+            plan(&serialization_plan::get(obj.get_derived_type()))
+        {
+        }
+
+        // 'obj' and 'view' refer to 'value'; a frame is therefore never moved, once it was created
+        frame(frame_kind k, variant&& v, std::size_t i)
+        :   kind(k),
+            value(std::move(v)),
+            obj(k == frame_kind::object ? get_object(value) : instance()),
+            index(i)
+        {
+            if (kind == frame_kind::object)
+            {
+                plan = &serialization_plan::get(obj.get_derived_type());
+            }
+            else if (kind == frame_kind::array)
+            {
+                view = value.create_sequential_view();
+                view.set_size(0);
+                item_plan = &serialization_plan::get(view.get_value_type());
+            }
+            else if (kind == frame_kind::map)
+            {
+                map_view = value.create_associative_view();
+                map_view.clear();
+                item_plan = &serialization_plan::get(map_view.get_key_type());
+                if (!map_view.is_key_only_type())
+                    mapped_plan = &serialization_plan::get(map_view.get_value_type());
+            }
+        }
+
+        //! Returns the plan of the value, which is read next by this frame; or `nullptr`, when it is not known
+        const serialization_plan* get_child_plan() const
+        {
+            switch (kind)
+            {
+                case frame_kind::object:    return (field ? &serialization_plan::get(field->value_type) : nullptr);
+                case frame_kind::array:     return item_plan;
+                case frame_kind::map:       return (mapped_plan ? nullptr : item_plan); // an entry of a map is no value
+                case frame_kind::map_entry: return (slot == entry_slot::key ? item_plan :
+                                                    (slot == entry_slot::value ? mapped_plan : nullptr));
+                default:                    return nullptr;
+            }
+        }
+
+        frame_kind                  kind;
+        variant                     value;
+        instance                    obj;
+        const serialization_plan*   plan = nullptr;
+        const field_op*             field = nullptr;
+        variant_sequential_view     view;
+        //! The plan of the items of an array, or of the keys of a map
+        const serialization_plan*   item_plan = nullptr;
+        variant_associative_view    map_view;
+        const serialization_plan*   mapped_plan = nullptr;
+        entry_slot                  slot = entry_slot::none;
+        variant                     entry_key;
+        variant                     entry_value;
+        std::size_t                 size = 0;
+        std::size_t                 index = 0;
+        std::size_t                 skip_depth = 0;
+    };
+
+    /*!
+     * Opens a frame for the object or array, which starts at the current position of the top frame.
+     * Returns false, when the json value cannot be mapped.
+     */
+    bool open_child(frame_kind kind)
+    {
+        auto& parent = m_frames.back();
+        if (parent.kind == frame_kind::map && parent.mapped_plan)
+        {
+            // every entry of a map is an object with a key and a value
+            if (kind != frame_kind::object)
+                return false;
+
+            m_frames.emplace_back(frame_kind::map_entry);
+            m_frames.back().item_plan = parent.item_plan;
+            m_frames.back().mapped_plan = parent.mapped_plan;
+            return true;
+        }
+
+        const serialization_plan* child_plan = parent.get_child_plan();
+        if (!child_plan)
+            return false;
+
+        if (kind == frame_kind::array)
+        {
+            if (child_plan->get_kind() == value_kind::associative_container)
+                kind = frame_kind::map;
+            else if (child_plan->get_kind() != value_kind::sequential_container)
+                return false;
+        }
+
+        variant value;
+        std::size_t index = 0;
+        if (parent.kind == frame_kind::object)
+        {
+            value = parent.field->accessor.get_value(parent.obj);
+        }
+        else if (parent.kind == frame_kind::array)
+        {
+            index = parent.size++;
+            parent.view.set_size(parent.size);
+            value = parent.view.get_value(index).extract_wrapped_value();
+        }
+        else
+        {
+            // the keys and values of an associative container are created, before they are inserted
+            value = create_value(child_plan->get_type());
+            index = static_cast<std::size_t>(parent.slot);
+        }
+
+        if (!value)
+            return false;
+
+        m_frames.emplace_back(kind, std::move(value), index);
+        return true;
+    }
+
+    bool close_frame()
+    {
+        auto& current = m_frames.back();
+        if (current.kind == frame_kind::skip && current.skip_depth > 0)
+        {
+            --current.skip_depth;
+            return true;
+        }
+
+        const frame_kind kind = current.kind;
+        variant value = std::move(current.value);
+        variant entry_key = std::move(current.entry_key);
+        variant entry_value = std::move(current.entry_value);
+        const std::size_t index = current.index;
+        m_frames.pop_back();
+
+        if (m_frames.empty() || kind == frame_kind::skip)
+            return true;
+
+        auto& parent = m_frames.back();
+        if (kind == frame_kind::map_entry)
+        {
+            if (entry_key && entry_value)
+                parent.map_view.insert(entry_key, entry_value);
+        }
+        else if (parent.kind == frame_kind::object)
+        {
+            parent.field->accessor.set_value(parent.obj, value);
+            parent.field = nullptr;
+        }
+        else if (parent.kind == frame_kind::array)
+        {
+            parent.view.set_value(index, value);
+        }
+        else if (parent.kind == frame_kind::map)
+        {
+            parent.map_view.insert(value);
+        }
+        else if (parent.kind == frame_kind::map_entry)
+        {
+            (static_cast<entry_slot>(index) == entry_slot::key ? parent.entry_key : parent.entry_value) = std::move(value);
+            parent.slot = entry_slot::none;
+        }
+
+        return true;
+    }
+
+    template<typename T>
+    bool set_value(T&& json_value)
+    {
+        if (m_frames.empty())
+            return true;
+
+        auto& current = m_frames.back();
+        if (current.kind == frame_kind::object)
+        {
+            if (!current.field)
+                return true;
+
+            variant var = std::forward<T>(json_value);
+            if (convert_value(var, current.field->kind, current.field->value_type))
+                current.field->accessor.set_value(current.obj, var);
+
+            current.field = nullptr;
+        }
+        else if (current.kind == frame_kind::array)
+        {
+            const std::size_t index = current.size++;
+            current.view.set_size(current.size);
+
+            variant var = std::forward<T>(json_value);
+            if (convert_value(var, current.item_plan->get_kind(), current.item_plan->get_type()))
+                current.view.set_value(index, var);
+        }
+        else if (current.kind == frame_kind::map || current.kind == frame_kind::map_entry)
+        {
+            const serialization_plan* plan = current.get_child_plan();
+            if (!plan)
+                return true;
+
+            const entry_slot slot = current.slot;
+            current.slot = entry_slot::none;
+
+            variant var = std::forward<T>(json_value);
+            if (!convert_value(var, plan->get_kind(), plan->get_type()))
+                return true;
+
+            if (current.kind == frame_kind::map)
+                current.map_view.insert(var);
+            else if (slot == entry_slot::key)
+                current.entry_key = std::move(var);
+            else
+                current.entry_value = std::move(var);
+        }
+
+        return true;
+    }
+
+    instance            m_root;
+    std::deque<frame>   m_frames;
+};
+
+} // end namespace anonymous
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+namespace io
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool from_json(std::istream& in, rttr::instance obj)
+{
+    if (!obj.is_valid())
+        return false;
+
+    try
+    {
+        json_object_reader reader(obj);
+        return json::sax_parse(in, &reader);
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "JSON parsing error: " << e.what() << std::endl;
+        return false;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace io
@@ -31,6 +31,7 @@
 #include <array>
 #include <map>
 #include <iostream>
+#include <sstream>
 
 #include <rttr/registration>
 
@@ -153,6 +154,18 @@ int main(int argc, char** argv)
 
     std::cout << "Circle c_2:\n" << io::to_json(c_2) << std::endl;
 
+    // the streaming functions write and read the tokens directly, without a json document in memory
+    std::stringstream json_stream;
+    io::to_json(c_2, json_stream);
+
+    circle c_3("Circle #3");
+    io::from_json(json_stream, c_3);
+    std::cout << "\n############################################\n" << std::endl;
+
+    std::cout << "Circle c_3 (streamed):\n";
+    io::to_json(c_3, std::cout);
+    std::cout << std::endl;
+
     return 0;
 }
 
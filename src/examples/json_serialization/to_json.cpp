@@ -35,8 +35,12 @@
 #include <nlohmann/json.hpp>
 #include <rttr/type>
 
+#include "serialization_plan.h"
+
 using json = nlohmann::json;
 using namespace rttr;
+using io::serialization_plan;
+using io::value_kind;
 
 
 namespace
@@ -50,87 +54,79 @@ json to_json_recursively(const instance& obj);
 
 json write_variant(const variant& var);
 
-json write_atomic_types_to_json(const type& t, const variant& var)
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+T get_basic_value(const variant& var)
+{
+    // a property returns its value with exactly the registered type, so the conversion is only a fallback
+    if (var.is_type<T>())
+        return var.get_value<T>();
+    else
+        return var.convert<T>();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+json write_basic_value(value_kind kind, const variant& var)
 {
-    if (t.is_arithmetic())
+    switch (kind)
     {
-        if (t == type::get<bool>())
-            return var.to_bool();
-        else if (t == type::get<char>())
-            return var.to_bool();
-        else if (t == type::get<int8_t>())
-            return var.to_int8();
-        else if (t == type::get<int16_t>())
-            return var.to_int16();
-        else if (t == type::get<int32_t>())
-            return var.to_int32();
-        else if (t == type::get<int64_t>())
-            return var.to_int64();
-        else if (t == type::get<uint8_t>())
-            return var.to_uint8();
-        else if (t == type::get<uint16_t>())
-            return var.to_uint16();
-        else if (t == type::get<uint32_t>())
-            return var.to_uint32();
-        else if (t == type::get<uint64_t>())
-            return var.to_uint64();
-        else if (t == type::get<float>())
-            return var.to_double();
-        else if (t == type::get<double>())
-            return var.to_double();
-
-        return json{};
+        case value_kind::boolean:   return get_basic_value<bool>(var);
+        case value_kind::character: return get_basic_value<char>(var);
+        case value_kind::int8:      return get_basic_value<int8_t>(var);
+        case value_kind::int16:     return get_basic_value<int16_t>(var);
+        case value_kind::int32:     return get_basic_value<int32_t>(var);
+        case value_kind::int64:     return get_basic_value<int64_t>(var);
+        case value_kind::uint8:     return get_basic_value<uint8_t>(var);
+        case value_kind::uint16:    return get_basic_value<uint16_t>(var);
+        case value_kind::uint32:    return get_basic_value<uint32_t>(var);
+        case value_kind::uint64:    return get_basic_value<uint64_t>(var);
+        case value_kind::float32:   return get_basic_value<float>(var);
+        case value_kind::float64:   return get_basic_value<double>(var);
+        case value_kind::string:    return get_basic_value<std::string>(var);
+        default:                    return json{};
     }
-    else if (t.is_enumeration())
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+json write_enumeration(const variant& var)
+{
+    bool ok = false;
+    auto result = var.to_string(&ok);
+    if (ok)
     {
-        bool ok = false;
-        auto result = var.to_string(&ok);
-        if (ok)
-        {
-            return var.to_string();
-        }
-        else
-        {
-            ok = false;
-            auto value = var.to_uint64(&ok);
-            if (ok)
-                return value;
-            else
-                return nullptr;
-        }
+        return result;
     }
-    else if (t == type::get<std::string>())
+    else
     {
-        return var.to_string();
+        ok = false;
+        auto value = var.to_uint64(&ok);
+        if (ok)
+            return value;
+        else
+            return nullptr;
     }
-
-    return json{};
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+json write_value(value_kind kind, const variant& var);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 static json write_array(const variant_sequential_view& view)
 {
     json array_json = json::array();
+    const value_kind item_kind = serialization_plan::get(view.get_value_type()).get_kind();
+
     for (const auto& item : view)
     {
-        if (item.is_sequential_container())
-        {
+        if (item_kind == value_kind::sequential_container)
             array_json.push_back(write_array(item.create_sequential_view()));
-        }
         else
-        {
-            variant wrapped_var = item.extract_wrapped_value();
-            type value_type = wrapped_var.get_type();
-            if (value_type.is_arithmetic() || value_type == type::get<std::string>() || value_type.is_enumeration())
-            {
-                array_json.push_back(write_atomic_types_to_json(value_type, wrapped_var));
-            }
-            else // object
-            {
-                array_json.push_back(to_json_recursively(wrapped_var));
-            }
-        }
+            array_json.push_back(write_value(item_kind, item.extract_wrapped_value()));
     }
     return array_json;
 }
@@ -140,25 +136,27 @@ static json write_array(const variant_sequential_view& view)
 
 static json write_associative_container(const variant_associative_view& view)
 {
-    static const string_view key_name("key");
-    static const string_view value_name("value");
+    static const std::string key_name("key");
+    static const std::string value_name("value");
 
     json array_json = json::array();
+    const value_kind key_kind = serialization_plan::get(view.get_key_type()).get_kind();
 
     if (view.is_key_only_type())
     {
         for (auto& item : view)
         {
-            array_json.push_back(write_variant(item.first));
+            array_json.push_back(write_value(key_kind, item.first.extract_wrapped_value()));
         }
     }
     else
     {
+        const value_kind mapped_kind = serialization_plan::get(view.get_value_type()).get_kind();
         for (auto& item : view)
         {
             json obj_json = json::object();
-            obj_json[key_name.data()] = write_variant(item.first);
-            obj_json[value_name.data()] = write_variant(item.second);
+            obj_json[key_name] = write_value(key_kind, item.first.extract_wrapped_value());
+            obj_json[value_name] = write_value(mapped_kind, item.second.extract_wrapped_value());
             array_json.push_back(obj_json);
         }
     }
@@ -168,72 +166,65 @@ static json write_associative_container(const variant_associative_view& view)
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-json write_variant(const variant& var)
+json write_object(const variant& var)
 {
-    auto value_type = var.get_type();
-    auto wrapped_type = value_type.is_wrapper() ? value_type.get_wrapped_type() : value_type;
-    bool is_wrapper = wrapped_type != value_type;
-
-    // Try atomic types first
-    auto atomic_result = write_atomic_types_to_json(is_wrapper ? wrapped_type : value_type,
-                                                   is_wrapper ? var.extract_wrapped_value() : var);
-    if (atomic_result.is_string() || atomic_result.is_number() || atomic_result.is_boolean() || atomic_result.is_null())
-    {
-        return atomic_result;
-    }
-    else if (var.is_sequential_container())
-    {
-        return write_array(var.create_sequential_view());
-    }
-    else if (var.is_associative_container())
-    {
-        return write_associative_container(var.create_associative_view());
-    }
-    else
+    const instance obj = var;
+    if (!serialization_plan::get(obj.get_derived_type()).get_fields().empty())
+        return to_json_recursively(obj);
+
+    bool ok = false;
+    auto text = var.to_string(&ok);
+    if (ok)
+        return text;
+
+    return nullptr;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+json write_value(value_kind kind, const variant& var)
+{
+    if (io::is_basic_kind(kind))
+        return write_basic_value(kind, var);
+
+    switch (kind)
     {
-        auto child_props = is_wrapper ? wrapped_type.get_properties() : value_type.get_properties();
-        if (!child_props.empty())
-        {
-            return to_json_recursively(var);
-        }
-        else
-        {
-            bool ok = false;
-            auto text = var.to_string(&ok);
-            if (ok)
-            {
-                return text;
-            }
-            return nullptr;
-        }
+        case value_kind::enumeration:           return write_enumeration(var);
+        case value_kind::sequential_container:  return write_array(var.create_sequential_view());
+        case value_kind::associative_container: return write_associative_container(var.create_associative_view());
+        case value_kind::wrapper:               return write_variant(var.extract_wrapped_value());
+        default:                                return write_object(var);
     }
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+json write_variant(const variant& var)
+{
+    return write_value(serialization_plan::get(var.get_type()).get_kind(), var);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 json to_json_recursively(const instance& obj2)
 {
     json obj_json = json::object();
     instance obj = obj2.get_type().get_raw_type().is_wrapper() ? obj2.get_wrapped_instance() : obj2;
 
-    auto prop_list = obj.get_derived_type().get_properties();
-    for (auto prop : prop_list)
+    const auto& plan = serialization_plan::get(obj.get_derived_type());
+    for (const auto& field : plan.get_fields())
     {
-        if (prop.get_metadata("NO_SERIALIZE"))
-            continue;
-
-        variant prop_value = prop.get_value(obj);
+        variant prop_value = field.accessor.get_value(obj);
         if (!prop_value)
             continue; // cannot serialize, because we cannot retrieve the value
 
-        const auto name = prop.get_name();
-        try 
+        try
         {
-            obj_json[name.data()] = write_variant(prop_value);
+            obj_json[field.name] = write_value(field.kind, prop_value);
         }
         catch (const std::exception& e)
         {
-            std::cerr << "cannot serialize property: " << name << " - " << e.what() << std::endl;
+            std::cerr << "cannot serialize property: " << field.name << " - " << e.what() << std::endl;
         }
     }
 
@@ -25,6 +25,7 @@
 *                                                                                   *
 *************************************************************************************/
 
+#include <ostream>
 #include <string>
 #include <rttr/type>
 
@@ -36,5 +37,15 @@ namespace io
  */
 std::string to_json(rttr::instance obj);
 
+/*!
+ * Serialize the given instance as compact json directly into the given stream \p out.
+ *
+ * No json document is created in memory; the tokens are written while the object graph is visited,
+ * so the memory usage does not grow with the size of the output.
+ * Like in \ref to_json(rttr::instance), a property which cannot be serialized is skipped;
+ * when a part of it was already written to \p out, the `failbit` of \p out is set instead.
+ */
+void to_json(rttr::instance obj, std::ostream& out);
+
 }
 
@@ -0,0 +1,394 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <type_traits>
+
+#include <iostream>
+
+#include <rttr/type>
+
+#include "to_json.h"
+#include "serialization_plan.h"
+
+using namespace rttr;
+using io::serialization_plan;
+using io::value_kind;
+
+
+namespace
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Writes json tokens into a small buffer, which is flushed to the output stream when it is full.
+ */
+class json_writer
+{
+public:
+    explicit json_writer(std::ostream& out) : m_out(out) { m_buffer.reserve(buffer_size); }
+    ~json_writer() { flush(); }
+
+    void start_object() { write_separator(); m_buffer.push_back('{'); m_need_comma = false; }
+    void end_object()   { m_buffer.push_back('}'); end_value(); }
+    void start_array()  { write_separator(); m_buffer.push_back('['); m_need_comma = false; }
+    void end_array()    { m_buffer.push_back(']'); end_value(); }
+
+    void key(const std::string& name)
+    {
+        write_separator();
+        write_string(name);
+        m_buffer.push_back(':');
+        m_need_comma = false;
+    }
+
+    void null_value()           { write_separator(); m_buffer.append("null"); end_value(); }
+    void bool_value(bool value) { write_separator(); m_buffer.append(value ? "true" : "false"); end_value(); }
+
+    void string_value(const std::string& value) { write_separator(); write_string(value); end_value(); }
+
+    template<typename T>
+    void number_value(T value)
+    {
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            if (!std::isfinite(value))
+                return null_value(); // json has no representation for NaN and infinity
+        }
+
+        write_separator();
+        char text[32];
+        const auto result = std::to_chars(text, text + sizeof(text), value);
+        m_buffer.append(text, result.ptr);
+        end_value();
+    }
+
+    void flush()
+    {
+        m_out.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+        m_flushed_size += m_buffer.size();
+        m_buffer.clear();
+    }
+
+    //! A position in the written tokens, see \ref rollback()
+    struct position
+    {
+        std::size_t flushed_size;
+        std::size_t buffer_size;
+        bool        need_comma;
+    };
+
+    position get_position() const { return {m_flushed_size, m_buffer.size(), m_need_comma}; }
+
+    /*!
+     * Removes all tokens, which were written after the position \p pos.
+     * Returns false, when this is not possible anymore, because the tokens were already flushed.
+     */
+    bool rollback(const position& pos)
+    {
+        if (pos.flushed_size != m_flushed_size)
+            return false;
+
+        m_buffer.resize(pos.buffer_size);
+        m_need_comma = pos.need_comma;
+        return true;
+    }
+
+private:
+    void write_separator()
+    {
+        if (m_need_comma)
+            m_buffer.push_back(',');
+    }
+
+    void end_value()
+    {
+        m_need_comma = true;
+        if (m_buffer.size() >= buffer_size)
+            flush();
+    }
+
+    void write_string(const std::string& text)
+    {
+        m_buffer.push_back('"');
+        for (const char c : text)
+        {
+            switch (c)
+            {
+                case '"':   m_buffer.append("\\\""); break;
+                case '\\':  m_buffer.append("\\\\"); break;
+                case '\b':  m_buffer.append("\\b"); break;
+                case '\f':  m_buffer.append("\\f"); break;
+                case '\n':  m_buffer.append("\\n"); break;
+                case '\r':  m_buffer.append("\\r"); break;
+                case '\t':  m_buffer.append("\\t"); break;
+                default:
+                {
+                    if (static_cast<unsigned char>(c) < 0x20)
+                    {
+                        char escaped[8];
+                        std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned int>(c));
+                        m_buffer.append(escaped);
+                    }
+                    else
+                    {
+                        m_buffer.push_back(c);
+                    }
+                }
+            }
+        }
+        m_buffer.push_back('"');
+    }
+
+    static constexpr std::size_t buffer_size = 64 * 1024;
+
+    std::ostream&   m_out;
+    std::string     m_buffer;
+    std::size_t     m_flushed_size = 0;
+    bool            m_need_comma = false;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void write_object_recursively(json_writer& writer, const instance& obj);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void write_value(json_writer& writer, value_kind kind, const variant& var);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+T get_basic_value(const variant& var)
+{
+    if (var.is_type<T>())
+        return var.get_value<T>();
+    else
+        return var.convert<T>();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void write_basic_value(json_writer& writer, value_kind kind, const variant& var)
+{
+    switch (kind)
+    {
+        case value_kind::boolean:   return writer.bool_value(get_basic_value<bool>(var));
+        case value_kind::character: return writer.number_value(static_cast<int>(get_basic_value<char>(var)));
+        case value_kind::int8:      return writer.number_value(get_basic_value<int8_t>(var));
+        case value_kind::int16:     return writer.number_value(get_basic_value<int16_t>(var));
+        case value_kind::int32:     return writer.number_value(get_basic_value<int32_t>(var));
+        case value_kind::int64:     return writer.number_value(get_basic_value<int64_t>(var));
+        case value_kind::uint8:     return writer.number_value(get_basic_value<uint8_t>(var));
+        case value_kind::uint16:    return writer.number_value(get_basic_value<uint16_t>(var));
+        case value_kind::uint32:    return writer.number_value(get_basic_value<uint32_t>(var));
+        case value_kind::uint64:    return writer.number_value(get_basic_value<uint64_t>(var));
+        case value_kind::float32:   return writer.number_value(get_basic_value<float>(var));
+        case value_kind::float64:   return writer.number_value(get_basic_value<double>(var));
+        case value_kind::string:    return writer.string_value(get_basic_value<std::string>(var));
+        default:                    return writer.null_value();
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void write_enumeration(json_writer& writer, const variant& var)
+{
+    bool ok = false;
+    auto result = var.to_string(&ok);
+    if (ok)
+    {
+        writer.string_value(result);
+    }
+    else
+    {
+        ok = false;
+        auto value = var.to_uint64(&ok);
+        if (ok)
+            writer.number_value(value);
+        else
+            writer.null_value();
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void write_array(json_writer& writer, const variant_sequential_view& view)
+{
+    writer.start_array();
+    const value_kind item_kind = serialization_plan::get(view.get_value_type()).get_kind();
+
+    for (const auto& item : view)
+    {
+        if (item_kind == value_kind::sequential_container)
+            write_array(writer, item.create_sequential_view());
+        else
+            write_value(writer, item_kind, item.extract_wrapped_value());
+    }
+    writer.end_array();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void write_associative_container(json_writer& writer, const variant_associative_view& view)
+{
+    static const std::string key_name("key");
+    static const std::string value_name("value");
+
+    writer.start_array();
+    const value_kind key_kind = serialization_plan::get(view.get_key_type()).get_kind();
+
+    if (view.is_key_only_type())
+    {
+        for (auto& item : view)
+        {
+            write_value(writer, key_kind, item.first.extract_wrapped_value());
+        }
+    }
+    else
+    {
+        const value_kind mapped_kind = serialization_plan::get(view.get_value_type()).get_kind();
+        for (auto& item : view)
+        {
+            writer.start_object();
+            writer.key(key_name);
+            write_value(writer, key_kind, item.first.extract_wrapped_value());
+            writer.key(value_name);
+            write_value(writer, mapped_kind, item.second.extract_wrapped_value());
+            writer.end_object();
+        }
+    }
+
+    writer.end_array();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void write_object(json_writer& writer, const variant& var)
+{
+    const instance obj = var;
+    if (!serialization_plan::get(obj.get_derived_type()).get_fields().empty())
+        return write_object_recursively(writer, obj);
+
+    bool ok = false;
+    auto text = var.to_string(&ok);
+    if (ok)
+        writer.string_value(text);
+    else
+        writer.null_value();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void write_value(json_writer& writer, value_kind kind, const variant& var)
+{
+    if (io::is_basic_kind(kind))
+        return write_basic_value(writer, kind, var);
+
+    switch (kind)
+    {
+        case value_kind::enumeration:           return write_enumeration(writer, var);
+        case value_kind::sequential_container:  return write_array(writer, var.create_sequential_view());
+        case value_kind::associative_container: return write_associative_container(writer, var.create_associative_view());
+        case value_kind::wrapper:
+        {
+            const variant wrapped_var = var.extract_wrapped_value();
+            return write_value(writer, serialization_plan::get(wrapped_var.get_type()).get_kind(), wrapped_var);
+        }
+        default:                                return write_object(writer, var);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void write_object_recursively(json_writer& writer, const instance& obj2)
+{
+    writer.start_object();
+    instance obj = obj2.get_type().get_raw_type().is_wrapper() ? obj2.get_wrapped_instance() : obj2;
+
+    const auto& plan = serialization_plan::get(obj.get_derived_type());
+    for (const auto& field : plan.get_fields())
+    {
+        variant prop_value = field.accessor.get_value(obj);
+        if (!prop_value)
+            continue; // cannot serialize, because we cannot retrieve the value
+
+        // like the json document, a property which cannot be serialized is skipped
+        const auto pos = writer.get_position();
+        try
+        {
+            writer.key(field.name);
+            write_value(writer, field.kind, prop_value);
+        }
+        catch (const std::exception& e)
+        {
+            if (!writer.rollback(pos))
+                throw; // a part of the property was already written to the stream
+
+            std::cerr << "cannot serialize property: " << field.name << " - " << e.what() << std::endl;
+        }
+    }
+
+    writer.end_object();
+}
+
+} // end namespace anonymous
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+namespace io
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void to_json(rttr::instance obj, std::ostream& out)
+{
+    if (!obj.is_valid())
+        return;
+
+    json_writer writer(out);
+    try
+    {
+        write_object_recursively(writer, obj);
+    }
+    catch (const std::exception& e)
+    {
+        // the stream contains an incomplete json document
+        out.setstate(std::ios_base::failbit);
+        std::cerr << "cannot serialize object - " << e.what() << std::endl;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace io
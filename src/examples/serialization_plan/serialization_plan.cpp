@@ -0,0 +1,188 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "serialization_plan.h"
+
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+
+using namespace rttr;
+
+namespace io
+{
+
+namespace
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+value_kind get_arithmetic_kind(const type& t)
+{
+    if (t == type::get<bool>())
+        return value_kind::boolean;
+    else if (t == type::get<char>())
+        return value_kind::character;
+    else if (t == type::get<int8_t>())
+        return value_kind::int8;
+    else if (t == type::get<int16_t>())
+        return value_kind::int16;
+    else if (t == type::get<int32_t>())
+        return value_kind::int32;
+    else if (t == type::get<int64_t>())
+        return value_kind::int64;
+    else if (t == type::get<uint8_t>())
+        return value_kind::uint8;
+    else if (t == type::get<uint16_t>())
+        return value_kind::uint16;
+    else if (t == type::get<uint32_t>())
+        return value_kind::uint32;
+    else if (t == type::get<uint64_t>())
+        return value_kind::uint64;
+    else if (t == type::get<float>())
+        return value_kind::float32;
+    else
+        return value_kind::float64;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+value_kind get_value_kind(const type& t)
+{
+    if (t.is_wrapper())
+        return value_kind::wrapper;
+    else if (t.is_arithmetic())
+        return get_arithmetic_kind(t);
+    else if (t == type::get<std::string>())
+        return value_kind::string;
+    else if (t.is_enumeration())
+        return value_kind::enumeration;
+    else if (t.is_sequential_container())
+        return value_kind::sequential_container;
+    else if (t.is_associative_container())
+        return value_kind::associative_container;
+    else
+        return value_kind::object;
+}
+
+} // end namespace anonymous
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool is_basic_kind(value_kind kind)
+{
+    return (kind <= value_kind::string);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+uint32_t get_field_id(const std::string& name)
+{
+    uint32_t hash = 2166136261u;
+    for (const char c : name)
+    {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+serialization_plan::serialization_plan(const type& t)
+:   m_type(t),
+    m_kind(get_value_kind(t))
+{
+    if (m_kind != value_kind::object)
+        return;
+
+    for (auto prop : t.get_properties())
+    {
+        if (prop.get_metadata("NO_SERIALIZE"))
+            continue;
+
+        const type value_type = prop.get_type();
+        const variant serialized_name = prop.get_metadata("SERIALIZED_NAME");
+        std::string name = serialized_name ? serialized_name.to_string() : prop.get_name().to_string();
+        const uint32_t id = get_field_id(name);
+        m_fields.push_back({prop, value_type, get_value_kind(value_type), std::move(name), id});
+    }
+
+    m_field_index.reserve(m_fields.size());
+    m_field_id_index.reserve(m_fields.size());
+    for (std::size_t i = 0; i < m_fields.size(); ++i)
+    {
+        m_field_index.emplace(m_fields[i].name, i);
+        // the versioned binary format identifies a property only by its id
+        if (!m_field_id_index.emplace(m_fields[i].id, i).second)
+            throw std::logic_error("the serialized name of property '" + m_fields[i].name + "' in type '" +
+                                   t.get_name().to_string() + "' has the same id as another property; "
+                                   "rename it with the metadata 'SERIALIZED_NAME'");
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+const field_op* serialization_plan::find_field(const std::string& name) const
+{
+    const auto itr = m_field_index.find(name);
+    if (itr == m_field_index.end())
+        return nullptr;
+
+    return &m_fields[itr->second];
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+const field_op* serialization_plan::find_field(uint32_t id) const
+{
+    const auto itr = m_field_id_index.find(id);
+    if (itr == m_field_id_index.end())
+        return nullptr;
+
+    return &m_fields[itr->second];
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+const serialization_plan& serialization_plan::get(const type& t)
+{
+    static std::mutex plan_mutex;
+    static std::unordered_map<type, std::unique_ptr<serialization_plan>> plan_cache;
+
+    std::lock_guard<std::mutex> lock(plan_mutex);
+    auto& plan = plan_cache[t];
+    if (!plan)
+        plan.reset(new serialization_plan(t));
+
+    return *plan;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace io
@@ -0,0 +1,137 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef SERIALIZATION_PLAN_H_
+#define SERIALIZATION_PLAN_H_
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <rttr/type>
+
+namespace io
+{
+
+/*!
+ * The kind of a value, as it is needed for serialization.
+ * The basic kinds can be read from a variant with `get_value<T>()` directly.
+ *
+ * \remark The values are stored in binary data (see the binary serialization example), so they must never change;
+ *         a new kind gets a new value.
+ */
+enum class value_kind : uint8_t
+{
+    boolean                 = 0,
+    character               = 1,
+    int8                    = 2,
+    int16                   = 3,
+    int32                   = 4,
+    int64                   = 5,
+    uint8                   = 6,
+    uint16                  = 7,
+    uint32                  = 8,
+    uint64                  = 9,
+    float32                 = 10,
+    float64                 = 11,
+    string                  = 12,
+    enumeration             = 13,
+    sequential_container    = 14,
+    associative_container   = 15,
+    wrapper                 = 16,
+    object                  = 17
+};
+
+/*!
+ * Returns true when the given kind \p kind is a number, a boolean or a string.
+ */
+bool is_basic_kind(value_kind kind);
+
+/*!
+ * A single serialization step of an object; it writes or reads one property.
+ */
+struct field_op
+{
+    rttr::property  accessor;
+    rttr::type      value_type;
+    value_kind      kind;
+    std::string     name;
+    uint32_t        id;
+};
+
+/*!
+ * Returns the id of a field with the given name \p name; this is the 32 bit FNV-1a hash of the name.
+ */
+uint32_t get_field_id(const std::string& name);
+
+/*!
+ * The serialization plan of a type, compiled only once per \ref rttr::type.
+ *
+ * It contains the kind of the type and for objects the flat list of its serializable properties;
+ * properties with the metadata `"NO_SERIALIZE"` are skipped.
+ * A property is serialized with its name, or with the name given by the metadata `"SERIALIZED_NAME"`;
+ * e.g. in order to rename a property, without breaking existing data.
+ */
+class serialization_plan
+{
+public:
+    /*!
+     * Returns the plan for the given type \p t; the first call compiles it, later calls return the cached plan.
+     * The returned reference stays valid until the end of the program.
+     *
+     * \remark Throws a `std::logic_error`, when two serialized names of \p t have the same id, see \ref get_field_id().
+     */
+    static const serialization_plan& get(const rttr::type& t);
+
+    rttr::type get_type() const { return m_type; }
+    value_kind get_kind() const { return m_kind; }
+    const std::vector<field_op>& get_fields() const { return m_fields; }
+
+    /*!
+     * Returns the field with the given name \p name; or `nullptr` when the type has no such serializable property.
+     */
+    const field_op* find_field(const std::string& name) const;
+
+    /*!
+     * Returns the field with the given id \p id; or `nullptr` when the type has no such serializable property.
+     */
+    const field_op* find_field(uint32_t id) const;
+
+private:
+    explicit serialization_plan(const rttr::type& t);
+
+    rttr::type              m_type;
+    value_kind              m_kind;
+    std::vector<field_op>   m_fields;
+    std::unordered_map<std::string, std::size_t> m_field_index;
+    std::unordered_map<uint32_t, std::size_t> m_field_id_index;
+};
+
+} // end namespace io
+
+#endif // SERIALIZATION_PLAN_H_
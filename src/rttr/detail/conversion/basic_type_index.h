@@ -0,0 +1,87 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_BASIC_TYPE_INDEX_H_
+#define RTTR_BASIC_TYPE_INDEX_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/misc/misc_type_traits.h"
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * All types, which can be converted into each other without a registered converter function.
+ *
+ * The position of a type inside this list is its basic type index; it is stored in the type_data
+ * and used to look up the conversion function in a table, instead of comparing the target type
+ * against every basic type.
+ */
+using basic_type_list = type_list<bool, char,
+                                  int8_t, int16_t, int32_t, int64_t,
+                                  uint8_t, uint16_t, uint32_t, uint64_t,
+                                  float, double,
+                                  std::string>;
+
+static constexpr std::size_t basic_type_count = type_list_size<basic_type_list>::value;
+
+//! The basic type index of all types, which are not part of \ref basic_type_list.
+static constexpr std::size_t invalid_basic_type_index = basic_type_count;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T, typename List, std::size_t Index = 0>
+struct basic_type_index_impl : std::integral_constant<std::size_t, invalid_basic_type_index> {};
+
+template<typename T, std::size_t Index, typename Head, typename... Tail>
+struct basic_type_index_impl<T, type_list<Head, Tail...>, Index>
+:   conditional_t<std::is_same<T, Head>::value,
+                  std::integral_constant<std::size_t, Index>,
+                  basic_type_index_impl<T, type_list<Tail...>, Index + 1>>
+{
+};
+
+/*!
+ * Returns the position of \p T inside \ref basic_type_list, or \ref invalid_basic_type_index.
+ */
+template<typename T>
+using basic_type_index = basic_type_index_impl<T, basic_type_list>;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_BASIC_TYPE_INDEX_H_
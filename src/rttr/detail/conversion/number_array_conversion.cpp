@@ -0,0 +1,190 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "rttr/detail/conversion/number_array_conversion.h"
+
+#include "rttr/type.h"
+#include "rttr/variant.h"
+#include "rttr/detail/conversion/basic_type_index.h"
+#include "rttr/detail/variant/variant_data_converter.h"
+
+#include <array>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+//! The arithmetic types of \ref basic_type_list, in the same order.
+using number_type_list = type_list<bool, char,
+                                   int8_t, int16_t, int32_t, int64_t,
+                                   uint8_t, uint16_t, uint32_t, uint64_t,
+                                   float, double>;
+
+static constexpr std::size_t number_type_count = type_list_size<number_type_list>::value;
+
+static_assert(basic_type_index<bool>::value == 0 && basic_type_index<double>::value == number_type_count - 1,
+              "The arithmetic types have to be at the beginning of the basic type list.");
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * For these types the conversion of \ref convert_from is a range check, followed by a `static_cast`;
+ * \p bool and \p char have their own conversion rules.
+ */
+template<typename T>
+using is_plain_number = std::integral_constant<bool, std::is_arithmetic<T>::value &&
+                                                     !std::is_same<T, bool>::value &&
+                                                     !std::is_same<T, char>::value>;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The range check of \ref convert_from for two plain number types.
+ */
+template<typename F, typename T>
+static bool is_in_range(F value) noexcept
+{
+    if constexpr (std::is_integral<F>::value && std::is_integral<T>::value)
+    {
+        return std::in_range<T>(value);
+    }
+    else if constexpr (std::is_floating_point<F>::value && std::is_integral<T>::value && std::is_signed<T>::value)
+    {
+        return !(value > static_cast<F>(std::numeric_limits<T>::max()) ||
+                 value < -static_cast<F>(std::numeric_limits<T>::max()));
+    }
+    else if constexpr (std::is_floating_point<F>::value && std::is_integral<T>::value)
+    {
+        return !(value < 0 || value > static_cast<F>(std::numeric_limits<T>::max()));
+    }
+    else if constexpr (std::is_floating_point<F>::value && std::is_floating_point<T>::value && sizeof(T) < sizeof(F))
+    {
+        return !(value < -static_cast<F>(std::numeric_limits<T>::max()) ||
+                 value > static_cast<F>(std::numeric_limits<T>::max()));
+    }
+    else
+    {
+        return true; // widening, or integer to floating point
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename F, typename T>
+static bool check_numbers(const void* from, std::size_t count)
+{
+    const F* values = static_cast<const F*>(from);
+
+    if constexpr (is_plain_number<F>::value && is_plain_number<T>::value)
+    {
+        // no early exit, so the compiler can vectorize the loop
+        bool ok = true;
+        for (std::size_t i = 0; i < count; ++i)
+            ok &= is_in_range<F, T>(values[i]);
+
+        return ok;
+    }
+    else
+    {
+        T result;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (!convert_from<F>::to(values[i], result))
+                return false;
+        }
+
+        return true;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename F, typename T>
+static void convert_numbers(const void* from, void* to, std::size_t count)
+{
+    if (count == 0)
+        return;
+
+    const F* values = static_cast<const F*>(from);
+    T* results = static_cast<T*>(to);
+
+    if constexpr (std::is_same<F, T>::value)
+    {
+        std::memcpy(results, values, count * sizeof(T));
+    }
+    else if constexpr (is_plain_number<F>::value && is_plain_number<T>::value)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            results[i] = static_cast<T>(values[i]);
+    }
+    else
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            convert_from<F>::to(values[i], results[i]);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename F, typename... T>
+static constexpr std::array<number_array_converter, sizeof...(T)> make_converter_row(type_list<T...>) noexcept
+{
+    return {{ number_array_converter{ &check_numbers<F, T>, &convert_numbers<F, T> }... }};
+}
+
+template<typename... F>
+static constexpr std::array<std::array<number_array_converter, number_type_count>, sizeof...(F)>
+make_converter_table(type_list<F...>) noexcept
+{
+    return {{ make_converter_row<F>(number_type_list())... }};
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+number_array_converter get_number_array_converter(const type& source_type, const type& target_type) noexcept
+{
+    static constexpr auto converter_table = make_converter_table(number_type_list());
+
+    const std::size_t source_index = get_basic_type_index(source_type);
+    const std::size_t target_index = get_basic_type_index(target_type);
+    if (source_index < number_type_count && target_index < number_type_count)
+        return converter_table[source_index][target_index];
+    else
+        return number_array_converter();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
@@ -0,0 +1,76 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_NUMBER_ARRAY_CONVERSION_H_
+#define RTTR_NUMBER_ARRAY_CONVERSION_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#include <cstddef>
+
+namespace rttr
+{
+class type;
+
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Converts arrays of arithmetic values from one type into another.
+ *
+ * Every value is checked with the same rules as the conversion of a single value (see \ref convert_from),
+ * but the whole array is checked in one pass and converted in a second pass;
+ * so the target is only written, when all values can be converted.
+ */
+struct number_array_converter
+{
+    //! Returns `true`, when all \p count values at \p from can be converted.
+    bool (*m_check)(const void* from, std::size_t count) = nullptr;
+
+    //! Converts \p count values at \p from into \p to; the values have to be checked before.
+    void (*m_convert)(const void* from, void* to, std::size_t count) = nullptr;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Returns the converter for arrays of \p source_type into arrays of \p target_type.
+ *
+ * Both types have to be arithmetic types, which are known to RTTR without a registered converter
+ * (bool, char, the fixed size integer types, float and double);
+ * otherwise the function pointers of the returned converter are null.
+ */
+RTTR_LOCAL number_array_converter get_number_array_converter(const type& source_type, const type& target_type) noexcept;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_NUMBER_ARRAY_CONVERSION_H_
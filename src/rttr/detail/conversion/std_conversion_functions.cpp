@@ -27,14 +27,12 @@
 
 #include "rttr/detail/conversion/std_conversion_functions.h"
 
-#include "rttr/detail/conversion/number_conversion.h"
-
-#include <sstream>
-#include <locale>
+#include <charconv>
 #include <limits>
+#include <locale>
 #include <algorithm>
-#include <climits>
-#include <iomanip>
+#include <system_error>
+#include <type_traits>
 
 namespace rttr
 {
@@ -42,104 +40,157 @@ namespace detail
 {
 /////////////////////////////////////////////////////////////////////////////////////////
 
+/*!
+ * Writes \p value with std::to_chars, which is locale independent and does not throw.
+ * Floating point values are written with the shortest representation, which can be read back without loss.
+ */
+template<typename T>
+static std::string number_to_string(T value, bool* ok)
+{
+    // large enough for the shortest round-trip representation of any arithmetic type
+    char buffer[64];
+    const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    if (ok)
+        *ok = (result.ec == std::errc());
+
+    return (result.ec == std::errc() ? std::string(buffer, result.ptr) : std::string());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static bool is_space(char c) noexcept
+{
+    return (c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r');
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Reads the whole string \p source as a number of type \p T. The accepted grammar is the one of `std::stoX`/`std::strtod`:
+ *  - optional leading white spaces; trailing characters of any kind are rejected
+ *  - an optional sign, '+' or '-'; unsigned types reject '-'
+ *  - integers: decimal digits only, i.e. "0x10" is invalid
+ *  - floating point: a decimal number, "inf", "nan" or a hexadecimal number with a "0x" prefix, e.g. "0x1p3"
+ *
+ * Returns `false` when \p source does not match the grammar or the number is out of range.
+ */
 template<typename T>
-std::string to_string_impl(T value, bool* ok)
+static bool parse_number(const std::string& source, T& value) noexcept
 {
-    try
+    const char* first = source.data();
+    const char* const last = source.data() + source.size();
+
+    while (first != last && is_space(*first))
+        ++first;
+
+    bool negative = false;
+    if (first != last && (*first == '+' || *first == '-'))
     {
-        std::string text = std::to_string(value);
-        if (ok)
-            *ok = true;
-        return text;
+        negative = (*first == '-');
+        ++first;
     }
-    catch (...)
+
+    // std::from_chars accepts a '-' by itself, a second sign has to be rejected here
+    if (first == last || *first == '+' || *first == '-')
+        return false;
+
+    std::from_chars_result result;
+    if constexpr (std::is_floating_point<T>::value)
     {
-        if (ok)
-            *ok = false;
-        return std::string();
+        if ((last - first) > 2 && first[0] == '0' && (first[1] == 'x' || first[1] == 'X') &&
+            first[2] != '+' && first[2] != '-')
+            result = std::from_chars(first + 2, last, value, std::chars_format::hex);
+        else
+            result = std::from_chars(first, last, value);
+
+        if (negative)
+            value = -value;
     }
+    else if constexpr (std::is_signed<T>::value)
+    {
+        if (negative)
+            --first; // let std::from_chars read the sign, otherwise the lowest value would overflow
+        result = std::from_chars(first, last, value);
+    }
+    else
+    {
+        if (negative)
+            return false;
+        result = std::from_chars(first, last, value);
+    }
+
+    return (result.ec == std::errc() && result.ptr == last);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+static T string_to_number(const std::string& source, bool* ok) noexcept
+{
+    T value = T();
+    const bool result = parse_number(source, value);
+    if (ok)
+        *ok = result;
+
+    return (result ? value : T());
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 
 std::string to_string(int value, bool* ok)
 {
-    return to_string_impl(value, ok);
+    return number_to_string(value, ok);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 std::string to_string(long value, bool* ok)
 {
-    return to_string_impl(value, ok);
+    return number_to_string(value, ok);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 std::string to_string(long long value, bool* ok)
 {
-    return to_string_impl(value, ok);
+    return number_to_string(value, ok);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 std::string to_string(unsigned value, bool* ok)
 {
-    return to_string_impl(value, ok);
+    return number_to_string(value, ok);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 std::string to_string(unsigned long value, bool* ok)
 {
-    return to_string_impl(value, ok);
+    return number_to_string(value, ok);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 std::string to_string(unsigned long long value, bool* ok)
 {
-    return to_string_impl(value, ok);
+    return number_to_string(value, ok);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 std::string to_string(float value, bool* ok)
 {
-    try
-    {
-        std::stringstream ss;
-        ss << std::setprecision(std::numeric_limits<float>::digits10) << value;
-        if (ok)
-            *ok = true;
-        return ss.str();
-    }
-    catch (...)
-    {
-        if (ok)
-            *ok = false;
-        return std::string();
-    }
+    return number_to_string(value, ok);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 std::string to_string(double value, bool* ok)
 {
-    try
-    {
-        std::stringstream ss;
-        ss << std::setprecision(std::numeric_limits<double>::digits10) << value;
-        if (ok)
-            *ok = true;
-        return ss.str();
-    }
-    catch (...)
-    {
-        if (ok)
-            *ok = false;
-        return std::string();
-    }
+    return number_to_string(value, ok);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -168,168 +219,42 @@ bool string_to_bool(std::string text, bool* ok)
 
 int string_to_int(const std::string& source, bool* ok)
 {
-    try
-    {
-        std::size_t pos = 0;
-        const int value = std::stoi(source, &pos);
-        if (pos == source.length())
-        {
-            if (ok)
-                *ok = true;
-            return value;
-        }
-    }
-    catch (...)
-    {
-        if (ok)
-            *ok = false;
-        return 0;
-    }
-
-    if (ok)
-        *ok = false;
-    return 0;
+    return string_to_number<int>(source, ok);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 unsigned long string_to_ulong(const std::string& source, bool* ok)
 {
-    try
-    {
-        std::size_t pos = 0;
-        const long long value = std::stoll(source, &pos);
-        unsigned long result = 0;
-        if (pos == source.length() && convert_to(value, result))
-        {
-            if (ok)
-                *ok = true;
-            return result;
-        }
-    }
-    catch (...)
-    {
-        if (ok)
-            *ok = false;
-        return 0;
-    }
-
-    if (ok)
-        *ok = false;
-    return 0;
+    return string_to_number<unsigned long>(source, ok);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 long long string_to_long_long(const std::string& source, bool* ok)
 {
-    try
-    {
-        std::size_t pos = 0;
-        const long long value = std::stoll(source, &pos);
-        if (pos == source.length())
-        {
-            if (ok)
-                *ok = true;
-            return value;
-        }
-    }
-    catch (...)
-    {
-        if (ok)
-            *ok = false;
-        return 0;
-    }
-
-    if (ok)
-        *ok = false;
-    return 0;
+    return string_to_number<long long>(source, ok);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 unsigned long long string_to_ulong_long(const std::string& source, bool* ok)
 {
-    try
-    {
-        std::size_t pos = 0;
-        const auto itr = std::find_if(source.begin(), source.end(), [](char c){ return !std::isdigit(c, std::locale()); });
-        if (itr == source.end())
-        {
-            const unsigned long long value = std::stoull(source, &pos);
-            if (pos == source.length())
-            {
-                if (ok)
-                    *ok = true;
-                return value;
-            }
-        }
-    }
-    catch (...)
-    {
-        if (ok)
-            *ok = false;
-        return 0;
-    }
-
-    if (ok)
-        *ok = false;
-    return 0;
+    return string_to_number<unsigned long long>(source, ok);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 float string_to_float(const std::string& source, bool* ok)
 {
-    try
-    {
-        std::size_t pos = 0;
-        const float value = std::stof(source, &pos);
-        if (pos == source.length())
-        {
-            if (ok)
-                *ok = true;
-            return value;
-        }
-    }
-    catch (...)
-    {
-        if (ok)
-            *ok = false;
-        return 0;
-    }
-
-    if (ok)
-        *ok = false;
-    return 0;
+    return string_to_number<float>(source, ok);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 double string_to_double(const std::string& source, bool* ok)
 {
-    try
-    {
-        std::size_t pos = 0;
-        const double value = std::stod(source, &pos);
-        if (pos == source.length())
-        {
-            if (ok)
-                *ok = true;
-            return value;
-        }
-    }
-    catch (...)
-    {
-        if (ok)
-            *ok = false;
-        return 0;
-    }
-
-    if (ok)
-        *ok = false;
-
-    return 0;
+    return string_to_number<double>(source, ok);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,232 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_ENUMERATION_INDEX_H_
+#define RTTR_ENUMERATION_INDEX_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/misc/utility.h"
+#include "rttr/string_view.h"
+
+#include <array>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace rttr
+{
+namespace detail
+{
+
+static constexpr std::size_t invalid_enum_index = std::numeric_limits<std::size_t>::max();
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * \brief The enum_name_index class maps the names of an enumeration to their position.
+ *
+ * It is an open addressing hash table with linear probing, which is build once at registration time.
+ * The table has at least twice as many slots as names, so a lookup needs in average only one or two probes.
+ * When a name occurs more than once, the position of its first occurrence is returned.
+ */
+template<std::size_t N>
+class enum_name_index
+{
+    public:
+        void build(const std::array<string_view, N>& names) noexcept
+        {
+            m_slots.fill(invalid_enum_index);
+            for (std::size_t index = 0; index < N; ++index)
+            {
+                std::size_t slot = get_hash(names[index]) & slot_mask;
+                while (m_slots[slot] != invalid_enum_index)
+                {
+                    if (names[m_slots[slot]] == names[index])
+                        break;
+
+                    slot = (slot + 1) & slot_mask;
+                }
+
+                if (m_slots[slot] == invalid_enum_index)
+                    m_slots[slot] = index;
+            }
+        }
+
+        /*!
+         * \brief Returns the position of \p name inside \p names,
+         *        or \ref invalid_enum_index when the name could not be found.
+         */
+        std::size_t find(const std::array<string_view, N>& names, string_view name) const noexcept
+        {
+            return find(names, name, get_hash(name));
+        }
+
+        /*!
+         * \brief Returns the position of \p name inside \p names, with the already computed hash \p hash_value
+         *        of the name.
+         */
+        std::size_t find(const std::array<string_view, N>& names, string_view name, std::size_t hash_value) const noexcept
+        {
+            std::size_t slot = hash_value & slot_mask;
+            while (m_slots[slot] != invalid_enum_index)
+            {
+                const std::size_t index = m_slots[slot];
+                if (names[index] == name)
+                    return index;
+
+                slot = (slot + 1) & slot_mask;
+            }
+
+            return invalid_enum_index;
+        }
+
+    private:
+        static constexpr std::size_t get_slot_count() noexcept
+        {
+            std::size_t count = 2;
+            while (count < N * 2)
+                count *= 2;
+            return count;
+        }
+
+        static std::size_t get_hash(string_view name) noexcept
+        {
+            return generate_hash(name.data(), name.length());
+        }
+
+        static constexpr std::size_t slot_mask = get_slot_count() - 1;
+        std::array<std::size_t, get_slot_count()> m_slots;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * \brief The enum_value_index class maps the values of an enumeration to their position.
+ *
+ * When the values are (almost) contiguous, a dense table indexed by the distance to the smallest value is used,
+ * otherwise a list sorted by value, which is searched with a binary search.
+ * When a value occurs more than once, the position of its first occurrence is returned.
+ */
+template<typename Enum_Type, std::size_t N>
+class enum_value_index
+{
+    using underlying_type = typename std::underlying_type<Enum_Type>::type;
+
+    public:
+        void build(const std::array<Enum_Type, N>& values)
+        {
+            if (N == 0)
+                return;
+
+            const auto min_max = std::minmax_element(values.cbegin(), values.cend(),
+                                                     [](Enum_Type left, Enum_Type right)
+                                                     {
+                                                         return (to_underlying(left) < to_underlying(right));
+                                                     });
+            m_min_value = to_underlying(*min_max.first);
+            const std::uint64_t range = get_distance(to_underlying(*min_max.second));
+
+            if (range < N * 2)
+            {
+                m_dense_list.assign(static_cast<std::size_t>(range) + 1, invalid_enum_index);
+                for (std::size_t index = 0; index < N; ++index)
+                {
+                    auto& slot = m_dense_list[static_cast<std::size_t>(get_distance(to_underlying(values[index])))];
+                    if (slot == invalid_enum_index)
+                        slot = index;
+                }
+            }
+            else
+            {
+                m_sorted_list.reserve(N);
+                for (std::size_t index = 0; index < N; ++index)
+                    m_sorted_list.emplace_back(to_underlying(values[index]), index);
+
+                // stable, so the first occurrence of a value comes first
+                std::stable_sort(m_sorted_list.begin(), m_sorted_list.end(),
+                                 [](const value_data& left, const value_data& right)
+                                 {
+                                     return (left.first < right.first);
+                                 });
+            }
+        }
+
+        /*!
+         * \brief Returns the position of \p value, or \ref invalid_enum_index when the value could not be found.
+         */
+        std::size_t find(Enum_Type value) const noexcept
+        {
+            const underlying_type key = to_underlying(value);
+            if (!m_dense_list.empty())
+            {
+                if (key < m_min_value)
+                    return invalid_enum_index;
+
+                const std::uint64_t distance = get_distance(key);
+                return (distance < m_dense_list.size() ? m_dense_list[static_cast<std::size_t>(distance)]
+                                                       : invalid_enum_index);
+            }
+
+            auto itr = std::lower_bound(m_sorted_list.cbegin(), m_sorted_list.cend(), key,
+                                        [](const value_data& left, underlying_type right)
+                                        {
+                                            return (left.first < right);
+                                        });
+            if (itr != m_sorted_list.cend() && itr->first == key)
+                return itr->second;
+            else
+                return invalid_enum_index;
+        }
+
+    private:
+        static underlying_type to_underlying(Enum_Type value) noexcept
+        {
+            return static_cast<underlying_type>(value);
+        }
+
+        //! Returns the distance to the smallest value; the modular arithmetic is also correct for signed types.
+        std::uint64_t get_distance(underlying_type value) const noexcept
+        {
+            return (static_cast<std::uint64_t>(value) - static_cast<std::uint64_t>(m_min_value));
+        }
+
+        using value_data = std::pair<underlying_type, std::size_t>;
+
+        underlying_type             m_min_value = underlying_type();
+        std::vector<std::size_t>    m_dense_list;
+        std::vector<value_data>     m_sorted_list;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_ENUMERATION_INDEX_H_
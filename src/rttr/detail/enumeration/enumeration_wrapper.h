@@ -31,6 +31,7 @@
 #include "rttr/detail/base/core_prerequisites.h"
 #include "rttr/detail/enumeration/enumeration_wrapper_base.h"
 #include "rttr/detail/enumeration/enum_data.h"
+#include "rttr/detail/enumeration/enumeration_index.h"
 #include "rttr/argument.h"
 #include "rttr/variant.h"
 #include "rttr/string_view.h"
@@ -59,6 +60,8 @@ class enumeration_wrapper : public enumeration_wrapper_base, public metadata_han
                  m_enum_variant_values[index] = item.get_value();
                  ++index;
             }
+            m_name_index.build(m_enum_names);
+            m_value_index.build(m_enum_values);
             static_assert(std::is_enum<Enum_Type>::value, "No enum type provided, please create an instance of this class only for enum types!");
         }
 
@@ -84,30 +87,20 @@ class enumeration_wrapper : public enumeration_wrapper_base, public metadata_han
                 return string_view();
             }
 
-            const Enum_Type enum_value = value.get_value<Enum_Type>();
-            int index = 0;
-            for (const auto& item : m_enum_values)
-            {
-                if (item == enum_value)
-                    return m_enum_names[index];
-
-                ++index;
-            }
-
-            return string_view();
+            const std::size_t index = m_value_index.find(value.get_value<Enum_Type>());
+            return (index != invalid_enum_index ? m_enum_names[index] : string_view());
         }
 
         variant name_to_value(string_view name) const
         {
-            int index = 0;
-            for (const auto& item : m_enum_names)
-            {
-                if (item == name)
-                    return m_enum_values[index];
+            const std::size_t index = m_name_index.find(m_enum_names, name);
+            return (index != invalid_enum_index ? m_enum_variant_values[index] : variant());
+        }
 
-                ++index;
-            }
-            return variant();
+        variant name_to_value(const name_key& key) const
+        {
+            const std::size_t index = m_name_index.find(m_enum_names, key.get_name(), key.get_hash());
+            return (index != invalid_enum_index ? m_enum_variant_values[index] : variant());
         }
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
@@ -116,6 +109,8 @@ class enumeration_wrapper : public enumeration_wrapper_base, public metadata_han
         std::array< string_view, N >    m_enum_names;
         std::array< Enum_Type, N >      m_enum_values;
         std::array< variant, N >        m_enum_variant_values;
+        enum_name_index<N>              m_name_index;
+        enum_value_index<Enum_Type, N>  m_value_index;
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////
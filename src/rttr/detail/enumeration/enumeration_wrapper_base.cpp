@@ -111,6 +111,13 @@ variant enumeration_wrapper_base::name_to_value(string_view name) const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+variant enumeration_wrapper_base::name_to_value(const name_key& key) const
+{
+    return variant();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 variant enumeration_wrapper_base::get_metadata(const variant& key) const
 {
     return variant();
@@ -72,6 +72,8 @@ class RTTR_API enumeration_wrapper_base
 
         virtual variant name_to_value(string_view name) const;
 
+        virtual variant name_to_value(const name_key& key) const;
+
         void set_declaring_type(type declaring_type) noexcept;
 
         virtual variant get_metadata(const variant& key) const;
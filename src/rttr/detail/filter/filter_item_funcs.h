@@ -32,6 +32,9 @@
 #include "rttr/filter_item.h"
 #include "rttr/constructor.h"
 #include "rttr/array_range.h"
+#include "rttr/detail/type/class_data_impl.h"
+
+#include <vector>
 
 namespace rttr
 {
@@ -89,55 +92,54 @@ inline bool filter_member_item(const T& item, const type& t, filter_items filter
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-template<typename T>
-detail::default_predicate<T> get_filter_predicate(const type& t, filter_items filter)
+template<>
+inline bool filter_member_item(const constructor& item, const type&, filter_items filter)
 {
-    if (!is_valid_filter_item(filter))
-    {
-        return {[](const T&){ return false; }};
-    }
-    else
-    {
-        return {[filter, t](const T& item)
-        {
-            return filter_member_item<T>(item, t, filter);
-        }};
-    }
+    // a constructor is neither static nor inherited, so only the access level is checked
+    if (filter.test_flag(filter_item::public_access) && filter.test_flag(filter_item::non_public_access))
+        return true;
+    else if (filter.test_flag(filter_item::public_access))
+        return (item.get_access_level() == access_levels::public_access);
+
+    const auto access_level = item.get_access_level();
+    return (access_level == access_levels::private_access || access_level == access_levels::protected_access);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-template<>
-inline detail::default_predicate<constructor> get_filter_predicate(const type& t, filter_items filter)
+/*!
+ * Returns the items of \p items, which match the filter \p filter for the class \p t.
+ *
+ * The matching items are copied only once per filter combination into a list of \p cache,
+ * so the returned range needs no predicate and every following call no allocation.
+ */
+template<typename T>
+inline array_range<T> get_filtered_items(const std::vector<T>& items, const type& t, filter_items filter,
+                                         filtered_member_cache<T>& cache)
 {
-    if (!is_valid_filter_item(filter))
-    {
-        return {[](const constructor&){ return false; }};
-    }
-    else
+    if (items.empty() || !is_valid_filter_item(filter))
+        return array_range<T>();
+
+    const auto filter_index = static_cast<std::size_t>(filter) & (filtered_member_cache<T>::filter_count - 1);
+    auto list = cache.find(filter_index);
+    if (!list)
     {
-        return {[filter](const constructor& item)
+        auto new_list = detail::make_unique<std::vector<T>>();
+        for (const auto& item : items)
         {
-            bool result = true;
-
-            if (filter.test_flag(filter_item::public_access) && filter.test_flag(filter_item::non_public_access))
-            {
-                result &= true;
-            }
-            else if (filter.test_flag(filter_item::public_access))
-            {
-                result &= (item.get_access_level() == access_levels::public_access);
-            }
-            else if (filter.test_flag(filter_item::non_public_access))
-            {
-                const auto access_level = item.get_access_level();
-                result &= (access_level == access_levels::private_access || access_level == access_levels::protected_access);
-            }
-
-            return result;
-        }};
+            if (filter_member_item<T>(item, t, filter))
+                new_list->push_back(item);
+        }
+        new_list->shrink_to_fit();
+        list = cache.insert(filter_index, std::move(new_list));
     }
+
+    if (list->empty())
+        return array_range<T>();
+
+    return array_range<T>(list->data(), list->size());
 }
+
 /////////////////////////////////////////////////////////////////////////////////////////
 
 } // end namespace detail
@@ -219,6 +219,49 @@ struct associative_container_mapper_wrapper : iterator_wrapper_base<Tp>
         return false;
     }
 
+    /////////////////////////////////////////////////////////////////////////
+    // 'reserve' is optional for a mapper, when it is missing (or the container is const), 'false' is returned
+
+    static bool reserve(void* container, std::size_t size)
+    {
+        if constexpr (HasReserve<base_class, ConstType>)
+            return base_class::reserve(get_container(container), size);
+        else
+            return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////
+    // inserts 'count' keys (and values) which are stored contiguously in memory,
+    // 'values' is not used for key-only containers; returns the number of inserted elements
+
+    static std::size_t insert_range(void* container, const void* keys, const void* values, std::size_t count)
+    {
+        if constexpr (std::is_const<ConstType>::value)
+        {
+            return 0;
+        }
+        else
+        {
+            auto& obj = get_container(container);
+            const auto key_data = static_cast<const key_t*>(keys);
+            std::size_t inserted = 0;
+
+            if constexpr (std::is_void<value_t>::value)
+            {
+                for (std::size_t i = 0; i < count; ++i)
+                    inserted += base_class::insert_key(obj, key_data[i]).second;
+            }
+            else
+            {
+                const auto value_data = static_cast<const value_t*>(values);
+                for (std::size_t i = 0; i < count; ++i)
+                    inserted += base_class::insert_key_value(obj, key_data[i], value_data[i]).second;
+            }
+
+            return inserted;
+        }
+    }
+
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -311,6 +354,20 @@ struct associative_container_base
     {
         return {container.end(), false};
     }
+
+    // only the unordered containers can allocate their buckets in advance
+    static bool reserve(container_t& container, std::size_t size)
+    {
+        if constexpr (requires { container.reserve(size); })
+        {
+            container.reserve(size);
+            return true;
+        }
+        else
+        {
+            return false;
+        }
+    }
 };
 
 
@@ -526,6 +583,16 @@ struct associative_container_empty
     {
         return false;
     }
+
+    static bool reserve(void* container, std::size_t size)
+    {
+        return false;
+    }
+
+    static std::size_t insert_range(void* container, const void* keys, const void* values, std::size_t count)
+    {
+        return 0;
+    }
 };
 
 } // end namespace detail
@@ -0,0 +1,91 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_METHOD_HANDLE_IMPL_H_
+#define RTTR_METHOD_HANDLE_IMPL_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/method/typed_method_invoker.h"
+#include "rttr/type.h"
+
+#include <utility>
+
+namespace rttr
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename R, typename... Args>
+method_handle<R(Args...)>::method_handle() noexcept
+:   m_func(nullptr),
+    m_data(nullptr)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename R, typename... Args>
+method_handle<R(Args...)>::method_handle(const method& meth) noexcept
+:   method_handle()
+{
+    const auto invoker = meth.get_typed_invoker(type::get<R(*)(Args...)>());
+    if (invoker.func)
+    {
+        m_func = reinterpret_cast<invoker_func>(invoker.func);
+        m_data = invoker.data;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename R, typename... Args>
+inline bool method_handle<R(Args...)>::is_valid() const noexcept
+{
+    return (m_func != nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename R, typename... Args>
+inline method_handle<R(Args...)>::operator bool() const noexcept
+{
+    return (m_func != nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename R, typename... Args>
+inline R method_handle<R(Args...)>::operator()(Args... args) const
+{
+    return m_func(m_data, std::forward<Args>(args)...);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace rttr
+
+#endif // RTTR_METHOD_HANDLE_IMPL_H_
@@ -0,0 +1,78 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_NAME_KEY_IMPL_H_
+#define RTTR_NAME_KEY_IMPL_H_
+
+#include "rttr/detail/misc/utility.h"
+
+namespace rttr
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+constexpr name_key::name_key(string_view name) noexcept
+:   m_name(name),
+    m_hash(detail::generate_hash(name.data(), name.length()))
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+constexpr string_view name_key::get_name() const noexcept
+{
+    return m_name;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+constexpr std::size_t name_key::get_hash() const noexcept
+{
+    return m_hash;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+namespace literals
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+consteval name_key operator""_key(const char* text, std::size_t length) noexcept
+{
+    return name_key(string_view(text, length));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace literals
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace rttr
+
+#endif // RTTR_NAME_KEY_IMPL_H_
@@ -0,0 +1,145 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_PROPERTY_ACCESSOR_IMPL_H_
+#define RTTR_PROPERTY_ACCESSOR_IMPL_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/property/typed_property_invoker.h"
+
+namespace rttr
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Class_Type, typename T>
+property_accessor<Class_Type, T>::property_accessor() noexcept
+:   m_member(nullptr),
+    m_getter(nullptr),
+    m_getter_data(nullptr),
+    m_setter(nullptr),
+    m_setter_data(nullptr)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Class_Type, typename T>
+property_accessor<Class_Type, T>::property_accessor(const property& prop) noexcept
+:   property_accessor()
+{
+    const auto invoker = prop.get_typed_accessor(detail::get_typed_property_key<Class_Type, T>());
+    if (invoker.member)
+        m_member = *static_cast<T Class_Type::* const*>(invoker.member);
+
+    m_getter        = reinterpret_cast<getter_func>(invoker.getter);
+    m_getter_data   = invoker.getter_data;
+    m_setter        = reinterpret_cast<setter_func>(invoker.setter);
+    m_setter_data   = invoker.setter_data;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Class_Type, typename T>
+inline bool property_accessor<Class_Type, T>::is_valid() const noexcept
+{
+    return (m_member != nullptr || m_getter != nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Class_Type, typename T>
+inline property_accessor<Class_Type, T>::operator bool() const noexcept
+{
+    return is_valid();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Class_Type, typename T>
+inline bool property_accessor<Class_Type, T>::is_readonly() const noexcept
+{
+    return (m_setter == nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Class_Type, typename T>
+inline bool property_accessor<Class_Type, T>::has_ref() const noexcept
+{
+    return (m_member != nullptr && m_setter != nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Class_Type, typename T>
+inline T property_accessor<Class_Type, T>::get(const Class_Type& obj) const
+{
+    if (m_member)
+        return obj.*m_member;
+    else
+        return m_getter(m_getter_data, obj);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Class_Type, typename T>
+inline bool property_accessor<Class_Type, T>::set(Class_Type& obj, const T& value) const
+{
+    // the member pointer of a read only property is only used for reading
+    if (!m_setter)
+        return false;
+
+    if (m_member)
+        obj.*m_member = value;
+    else
+        m_setter(m_setter_data, obj, value);
+
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Class_Type, typename T>
+inline T& property_accessor<Class_Type, T>::get_ref(Class_Type& obj) const noexcept
+{
+    return obj.*m_member;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Class_Type, typename T>
+inline const T& property_accessor<Class_Type, T>::get_ref(const Class_Type& obj) const noexcept
+{
+    return obj.*m_member;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace rttr
+
+#endif // RTTR_PROPERTY_ACCESSOR_IMPL_H_
@@ -40,12 +40,24 @@
 #include <deque>
 #include <array>
 #include <initializer_list>
+#include <span>
 
 namespace rttr
 {
 namespace detail
 {
 
+/*!
+ * Describes the element storage of a sequential container, whose elements are stored contiguously in memory.
+ * For all other containers \p m_stride is zero.
+ */
+struct sequential_contiguous_data
+{
+    void*       m_data          = nullptr;
+    std::size_t m_size          = 0;
+    std::size_t m_stride        = 0;
+    bool        m_is_read_only  = true;
+};
 
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -129,6 +141,24 @@ struct sequential_container_mapper_wrapper : iterator_wrapper_base<Tp>
         return base_class::get_size(get_container(container));
     }
 
+    // only mappers of contiguous containers provide 'get_contiguous_data'
+    static sequential_contiguous_data get_contiguous_data(void* container)
+    {
+        if constexpr (HasContiguousData<base_class, ConstType>)
+        {
+            auto& obj = get_container(container);
+            const auto data = base_class::get_contiguous_data(obj);
+            using element_t = remove_pointer_t<decltype(data)>;
+
+            return { const_cast<void*>(static_cast<const void*>(data)), base_class::get_size(obj),
+                     sizeof(element_t), std::is_const<element_t>::value };
+        }
+        else
+        {
+            return {};
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////
 
     template<typename..., typename C = ConstType, enable_if_t<!std::is_const<C>::value, int> = 0>
@@ -196,6 +226,51 @@ struct sequential_container_mapper_wrapper : iterator_wrapper_base<Tp>
         end(container, itr);
     }
 
+    /////////////////////////////////////////////////////////////////////////
+    // 'reserve', 'insert_range' and 'erase_range' are optional for a mapper,
+    // when they are missing (or the container is const), 'false' is returned
+
+    static bool reserve(void* container, std::size_t size)
+    {
+        if constexpr (HasReserve<base_class, ConstType>)
+            return base_class::reserve(get_container(container), size);
+        else
+            return false;
+    }
+
+    static bool insert_range(void* container, const void* data, std::size_t count,
+                             const iterator_data& itr_pos, iterator_data& itr)
+    {
+        if constexpr (HasRangeInsert<base_class, ConstType, value_t>)
+        {
+            const auto first = static_cast<const value_t*>(data);
+            const auto ret = base_class::insert_range(get_container(container), first, first + count,
+                                                      itr_wrapper::get_iterator(itr_pos));
+            itr_wrapper::create(itr, ret);
+            return true;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    static bool erase_range(void* container, const iterator_data& itr_first, const iterator_data& itr_last,
+                            iterator_data& itr)
+    {
+        if constexpr (HasRangeErase<base_class, ConstType>)
+        {
+            const auto ret = base_class::erase_range(get_container(container), itr_wrapper::get_iterator(itr_first),
+                                                     itr_wrapper::get_iterator(itr_last));
+            itr_wrapper::create(itr, ret);
+            return true;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////
     // is_const<T> is used because of std::initializer_list, it can only return a constant value
     template<typename..., typename C = ConstType, typename ReturnType = decltype(base_class::get_value(std::declval<C&>(), 0)),
@@ -357,6 +432,30 @@ struct sequential_container_base_dynamic
     {
         return container.insert(itr_pos, value);
     }
+
+    static itr_t insert_range(container_t& container, const value_t* first, const value_t* last, const itr_t& itr_pos)
+    {
+        return container.insert(itr_pos, first, last);
+    }
+
+    static itr_t erase_range(container_t& container, const itr_t& first, const itr_t& last)
+    {
+        return container.erase(first, last);
+    }
+
+    // only containers with a 'reserve' member (e.g. std::vector) can allocate in advance
+    static bool reserve(container_t& container, std::size_t size)
+    {
+        if constexpr (requires { container.reserve(size); })
+        {
+            container.reserve(size);
+            return true;
+        }
+        else
+        {
+            return false;
+        }
+    }
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -500,6 +599,16 @@ struct sequential_container_base_static
     {
         return container[index];
     }
+
+    static value_t* get_contiguous_data(container_t& container)
+    {
+        return container.data();
+    }
+
+    static const value_t* get_contiguous_data(const container_t& container)
+    {
+        return container.data();
+    }
 };
 
 } // end namespace detail
@@ -594,6 +703,16 @@ struct sequential_container_mapper<T[N]>
     {
         return container[index];
     }
+
+    static value_t* get_contiguous_data(container_t& container)
+    {
+        return container;
+    }
+
+    static const value_t* get_contiguous_data(const container_t& container)
+    {
+        return container;
+    }
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -689,6 +808,11 @@ struct sequential_container_mapper<std::initializer_list<T>>
         std::advance(it, index);
         return *it;
     }
+
+    static const value_t* get_contiguous_data(const container_t& container)
+    {
+        return container.begin();
+    }
 };
 
 //////////////////////////////////////////////////////////////////////////////////////
@@ -800,6 +924,22 @@ struct sequential_container_mapper<std::vector<bool>>
 #endif
     }
 
+    static itr_t insert_range(container_t& container, const value_t* first, const value_t* last, const itr_t& itr_pos)
+    {
+        return container.insert(itr_pos, first, last);
+    }
+
+    static itr_t erase_range(container_t& container, const itr_t& first, const itr_t& last)
+    {
+        return container.erase(first, last);
+    }
+
+    static bool reserve(container_t& container, std::size_t size)
+    {
+        container.reserve(size);
+        return true;
+    }
+
     static std::vector<bool>::reference get_value(container_t& container, std::size_t index)
     {
         return container[index];
@@ -814,7 +954,18 @@ struct sequential_container_mapper<std::vector<bool>>
 //////////////////////////////////////////////////////////////////////////////////////
 
 template<typename T>
-struct sequential_container_mapper<std::vector<T>> : detail::sequential_container_base_dynamic_direct_access<std::vector<T>> {};
+struct sequential_container_mapper<std::vector<T>> : detail::sequential_container_base_dynamic_direct_access<std::vector<T>>
+{
+    static T* get_contiguous_data(std::vector<T>& container)
+    {
+        return container.data();
+    }
+
+    static const T* get_contiguous_data(const std::vector<T>& container)
+    {
+        return container.data();
+    }
+};
 template<typename T>
 struct sequential_container_mapper<std::list<T>> : detail::sequential_container_base_dynamic_itr_access<std::list<T>> {};
 template<typename T>
@@ -823,6 +974,82 @@ struct sequential_container_mapper<std::deque<T>> : detail::sequential_container
 template<typename T, std::size_t N>
 struct sequential_container_mapper<std::array<T, N>> : detail::sequential_container_base_static<std::array<T, N>> {};
 
+//////////////////////////////////////////////////////////////////////////////////////
+// a span has a fixed size and refers to the elements of another container,
+// so it is handled like a static container; a span of const elements is read-only
+
+template<typename T, std::size_t Extent>
+struct sequential_container_mapper<std::span<T, Extent>>
+{
+    using container_t   = std::span<T, Extent>;
+    using value_t       = typename std::span<T, Extent>::value_type;
+    using itr_t         = typename std::span<T, Extent>::iterator;
+    using const_itr_t   = typename std::span<T, Extent>::iterator;
+
+    static bool is_dynamic()
+    {
+        return false;
+    }
+
+    static T& get_data(const itr_t& itr)
+    {
+        return *itr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////
+
+    static itr_t begin(const container_t& container)
+    {
+        return container.begin();
+    }
+
+    static itr_t end(const container_t& container)
+    {
+        return container.end();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////
+
+    static void clear(container_t& container)
+    {
+    }
+
+    static bool is_empty(const container_t& container)
+    {
+        return container.empty();
+    }
+
+    static std::size_t get_size(const container_t& container)
+    {
+        return container.size();
+    }
+
+    static bool set_size(container_t& container, std::size_t size)
+    {
+        return false;
+    }
+
+    static itr_t erase(container_t& container, const itr_t& itr)
+    {
+        return end(container);
+    }
+
+    static itr_t insert(container_t& container, const value_t& value, const itr_t& itr_pos)
+    {
+        return end(container);
+    }
+
+    static T& get_value(const container_t& container, std::size_t index)
+    {
+        return container[index];
+    }
+
+    static T* get_contiguous_data(const container_t& container)
+    {
+        return container.data();
+    }
+};
+
 
 //////////////////////////////////////////////////////////////////////////////////////
 
@@ -867,6 +1094,11 @@ struct sequential_container_empty
         return false;
     }
 
+    static sequential_contiguous_data get_contiguous_data(void* container)
+    {
+        return {};
+    }
+
     static std::size_t get_rank()
     {
         return 0;
@@ -899,6 +1131,23 @@ struct sequential_container_empty
     {
     }
 
+    static bool reserve(void* container, std::size_t size)
+    {
+        return false;
+    }
+
+    static bool insert_range(void* container, const void* data, std::size_t count,
+                             const iterator_data& itr_pos, iterator_data& itr)
+    {
+        return false;
+    }
+
+    static bool erase_range(void* container, const iterator_data& itr_first, const iterator_data& itr_last,
+                            iterator_data& itr)
+    {
+        return false;
+    }
+
     static bool set_value(void* container, std::size_t index, argument& value)
     {
         return false;
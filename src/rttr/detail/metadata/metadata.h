@@ -36,6 +36,8 @@ namespace rttr
 namespace detail
 {
 
+class metadata_index;
+
 /*!
  * This class holds meta data.
  *
@@ -69,6 +71,8 @@ class RTTR_API metadata
         };
 
     private:
+        friend class metadata_index;
+
         variant m_key;
         variant m_value;
 };
@@ -30,6 +30,7 @@
 
 #include "rttr/detail/base/core_prerequisites.h"
 #include "rttr/detail/metadata/metadata.h"
+#include "rttr/detail/metadata/metadata_index.h"
 #include "rttr/variant.h"
 
 #include <array>
@@ -47,22 +48,27 @@ template<std::size_t Metadata_Count>
 class metadata_handler
 {
     public:
-        inline metadata_handler(std::array<metadata, Metadata_Count> new_data) : m_metadata_list(std::move(new_data)) { }
+        inline metadata_handler(std::array<metadata, Metadata_Count> new_data) : m_metadata_list(std::move(new_data))
+        {
+            metadata_index::build(m_metadata_list.data(), m_index.data(), Metadata_Count);
+        }
 
         inline variant get_metadata(const variant& key) const
         {
-            // I don't expect that many data, so we iterate from start to end
-            for (const auto& item : m_metadata_list)
-            {
-                if (item.get_key() == key)
-                    return item.get_value();
-            }
+            if (const variant* value = get_metadata_value(make_metadata_key(key)))
+                return *value;
+            else
+                return variant();
+        }
 
-            return variant();
+        inline const variant* get_metadata_value(const metadata_key& key) const noexcept
+        {
+            return metadata_index::find(m_metadata_list.data(), m_index.data(), Metadata_Count, key);
         }
 
     private:
         std::array<metadata, Metadata_Count> m_metadata_list;
+        std::array<metadata_index::entry, Metadata_Count> m_index;
 };
 
 /*!
@@ -78,6 +84,8 @@ class metadata_handler<0>
         inline void set_metadata(std::array<metadata, 0> new_data) { }
 
         inline variant get_metadata(const variant& key) const  { return variant(); }
+
+        inline const variant* get_metadata_value(const metadata_key& key) const noexcept { return nullptr; }
 };
 
 } // end namespace detail
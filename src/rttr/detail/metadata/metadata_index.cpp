@@ -0,0 +1,199 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "rttr/detail/metadata/metadata_index.h"
+
+#include <algorithm>
+#include <string>
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static bool is_integral_key(const type& t) noexcept
+{
+    if (t.is_enumeration())
+        return true;
+
+    return (t.is_arithmetic() && t != type::get<float>() && t != type::get<double>() && t != type::get<long double>());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static bool get_key_text(const variant& key, string_view& text) noexcept
+{
+    if (key.is_type<std::string>())
+        text = key.get_value<std::string>();
+    else if (key.is_type<string_view>())
+        text = key.get_value<string_view>();
+    else
+        return false;
+
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+metadata_key make_metadata_key(const variant& key) noexcept
+{
+    metadata_key result;
+    result.m_key = &key;
+
+    if (is_integral_key(key.get_type()))
+    {
+        bool ok = false;
+        const auto signed_value = key.to_int64(&ok);
+        if (ok)
+            result.m_integral = static_cast<std::uint64_t>(signed_value);
+        else
+            result.m_integral = key.to_uint64(&ok);
+
+        if (ok)
+        {
+            result.m_kind = metadata_key_kind::integral;
+            result.m_hash = static_cast<std::size_t>(result.m_integral);
+        }
+    }
+    else if (get_key_text(key, result.m_text))
+    {
+        result.m_kind = metadata_key_kind::string;
+        result.m_hash = generate_hash(result.m_text.data(), result.m_text.length());
+    }
+
+    return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant create_string_metadata_key(const metadata_key& key)
+{
+    return variant(std::string(key.m_text.data(), key.m_text.length()));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void metadata_index::build(const metadata* list, entry* entries, std::size_t count) noexcept
+{
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const auto key = make_metadata_key(list[i].m_key);
+        entries[i].m_hash       = key.m_hash;
+        entries[i].m_integral   = key.m_integral;
+        entries[i].m_position   = i;
+        entries[i].m_kind       = key.m_kind;
+    }
+
+    // all keys which cannot be hashed, are placed at the end
+    std::stable_sort(entries, entries + count, [](const entry& left, const entry& right)
+    {
+        const bool left_is_other = (left.m_kind == metadata_key_kind::other);
+        const bool right_is_other = (right.m_kind == metadata_key_kind::other);
+        if (left_is_other != right_is_other)
+            return right_is_other;
+
+        return (left.m_hash < right.m_hash);
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool metadata_index::is_equal(const metadata& item, const entry& item_entry, const metadata_key& key) noexcept
+{
+    if (item_entry.m_kind != key.m_kind)
+        return false;
+
+    if (key.m_kind == metadata_key_kind::integral)
+        return (item_entry.m_integral == key.m_integral);
+
+    string_view text;
+    return (get_key_text(item.m_key, text) && text == key.m_text);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+const variant* metadata_index::find(const metadata* list, const entry* entries, std::size_t count,
+                                    const metadata_key& key) noexcept
+{
+    const auto end = entries + count;
+    if (key.m_kind != metadata_key_kind::other)
+    {
+        auto itr = std::lower_bound(entries, end, key.m_hash, [](const entry& item, std::size_t hash)
+        {
+            return (item.m_kind != metadata_key_kind::other && item.m_hash < hash);
+        });
+
+        for (; itr != end && itr->m_kind != metadata_key_kind::other && itr->m_hash == key.m_hash; ++itr)
+        {
+            if (is_equal(list[itr->m_position], *itr, key))
+                return &list[itr->m_position].m_value;
+        }
+
+        // a key of another kind might still be equal to the given key (e.g. '1' and 1 or 1.0 and 1),
+        // the variant of a typed key is only created, when there is such a key
+        variant created_key;
+        const variant* var_key = key.m_key;
+        for (itr = entries; itr != end; ++itr)
+        {
+            if (itr->m_kind == key.m_kind)
+                continue;
+
+            if (!var_key)
+            {
+                if (!key.m_create_key)
+                    return nullptr;
+
+                created_key = key.m_create_key(key);
+                var_key = &created_key;
+            }
+
+            if (list[itr->m_position].m_key == *var_key)
+                return &list[itr->m_position].m_value;
+        }
+
+        return nullptr;
+    }
+
+    if (!key.m_key)
+        return nullptr;
+
+    // the given key cannot be hashed, but it might still be equal to any registered key (e.g. '1.0' and '1')
+    for (auto itr = entries; itr != end; ++itr)
+    {
+        if (list[itr->m_position].m_key == *key.m_key)
+            return &list[itr->m_position].m_value;
+    }
+
+    return nullptr;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
@@ -0,0 +1,177 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_METADATA_INDEX_H_
+#define RTTR_METADATA_INDEX_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/metadata/metadata_key.h"
+
+#include <cstdint>
+#include <type_traits>
+
+namespace rttr
+{
+
+class variant;
+
+namespace detail
+{
+
+class metadata;
+
+/*!
+ * This class creates and searches an index over a list of \ref metadata.
+ *
+ * The keys are hashed once, when the index is build; the entries are sorted by this hash.
+ * An entry stores only the position of its metadata, so the list can be copied or moved,
+ * but the index has to be rebuild, when the list itself changes.
+ */
+class RTTR_API metadata_index
+{
+    public:
+        struct entry
+        {
+            std::size_t         m_hash      = 0;
+            std::uint64_t       m_integral  = 0;
+            std::size_t         m_position  = 0;
+            metadata_key_kind   m_kind      = metadata_key_kind::other;
+        };
+
+        /*!
+         * Fills \p entries with the index of the first \p count items of \p list.
+         */
+        static void build(const metadata* list, entry* entries, std::size_t count) noexcept;
+
+        /*!
+         * Returns a pointer to the value of the metadata with the given key \p key,
+         * or a `nullptr` when no such metadata exist.
+         */
+        static const variant* find(const metadata* list, const entry* entries, std::size_t count,
+                                   const metadata_key& key) noexcept;
+
+    private:
+        static bool is_equal(const metadata& item, const entry& item_entry, const metadata_key& key) noexcept;
+};
+
+} // end namespace detail
+} // end namespace rttr
+
+// the index needs only the declaration of variant and metadata; type_data.h uses it,
+// while it is itself included by variant.h
+#include "rttr/detail/metadata/metadata.h"
+#include "rttr/detail/misc/utility.h"
+
+namespace rttr
+{
+namespace detail
+{
+
+template<typename Key>
+using is_indexed_metadata_key = std::integral_constant<bool, std::is_integral<Key>::value ||
+                                                             std::is_enum<Key>::value ||
+                                                             std::is_convertible<const Key&, string_view>::value>;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Key>
+inline variant create_metadata_key_variant(const metadata_key& key)
+{
+    return variant(*static_cast<const Key*>(key.m_source));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Key>
+inline enable_if_t<is_indexed_metadata_key<Key>::value, metadata_key> make_metadata_key(const Key& key) noexcept
+{
+    metadata_key result;
+    result.m_source     = &key;
+    if constexpr (std::is_enum<Key>::value)
+    {
+        result.m_kind       = metadata_key_kind::integral;
+        result.m_integral   = static_cast<std::uint64_t>(static_cast<std::underlying_type_t<Key>>(key));
+        result.m_hash       = static_cast<std::size_t>(result.m_integral);
+        result.m_create_key = &create_metadata_key_variant<Key>;
+    }
+    else if constexpr (std::is_integral<Key>::value)
+    {
+        result.m_kind       = metadata_key_kind::integral;
+        result.m_integral   = static_cast<std::uint64_t>(key);
+        result.m_hash       = static_cast<std::size_t>(result.m_integral);
+        result.m_create_key = &create_metadata_key_variant<Key>;
+    }
+    else
+    {
+        result.m_kind       = metadata_key_kind::string;
+        result.m_text       = string_view(key);
+        result.m_hash       = generate_hash(result.m_text.data(), result.m_text.length());
+        result.m_create_key = &create_string_metadata_key;
+    }
+
+    return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Returns the value of the metadata \p value as pointer to \p T,
+ * when it does not contain a value of type \p T, a `nullptr` is returned.
+ */
+template<typename T>
+inline const T* get_metadata_value_as(const variant* value) noexcept
+{
+    if (value && value->is_type<T>())
+        return &value->get_value<T>();
+    else
+        return nullptr;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T, typename Key, typename Lookup_Func>
+inline const T* get_typed_metadata(const Key& key, const Lookup_Func& lookup)
+{
+    if constexpr (is_indexed_metadata_key<Key>::value)
+    {
+        return get_metadata_value_as<T>(lookup(make_metadata_key(key)));
+    }
+    else if constexpr (std::is_same<Key, variant>::value)
+    {
+        return get_metadata_value_as<T>(lookup(make_metadata_key(key)));
+    }
+    else
+    {
+        const variant var_key(key);
+        return get_metadata_value_as<T>(lookup(make_metadata_key(var_key)));
+    }
+}
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_METADATA_INDEX_H_
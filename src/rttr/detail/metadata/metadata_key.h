@@ -0,0 +1,100 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_METADATA_KEY_H_
+#define RTTR_METADATA_KEY_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/string_view.h"
+
+#include <cstdint>
+
+namespace rttr
+{
+
+class variant;
+
+namespace detail
+{
+
+/*!
+ * The kind of a metadata key; integral and enum keys are compared by their value,
+ * string keys by their text. All other keys are compared with the equal operator of \ref variant.
+ */
+enum class metadata_key_kind : uint8_t
+{
+    integral,
+    string,
+    other
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * A key used to search metadata, the hash is calculated only once.
+ */
+struct metadata_key
+{
+    metadata_key_kind   m_kind      = metadata_key_kind::other;
+    std::size_t         m_hash      = 0;
+    std::uint64_t       m_integral  = 0;
+    string_view         m_text;
+    //! The original key, only available when the key was created from a variant
+    const variant*      m_key       = nullptr;
+    //! The original key, when the key was not created from a variant
+    const void*         m_source    = nullptr;
+    //! Creates a variant from \p m_source, it is used when keys of different kinds have to be compared
+    variant           (*m_create_key)(const metadata_key& key) = nullptr;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Creates the key for the given variant \p key; the variant has to outlive the returned key.
+ */
+RTTR_API metadata_key make_metadata_key(const variant& key) noexcept;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Creates a variant with a `std::string` from the text of the string key \p key.
+ */
+RTTR_API variant create_string_metadata_key(const metadata_key& key);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Searches the metadata value for the given \p key with \p lookup, which has to accept a \ref metadata_key.
+ * Keys which are not integral, enum or string types are searched through a temporary variant.
+ */
+template<typename T, typename Key, typename Lookup_Func>
+inline const T* get_typed_metadata(const Key& key, const Lookup_Func& lookup);
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_METADATA_KEY_H_
@@ -0,0 +1,181 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "rttr/detail/method/method_resolution_cache.h"
+
+#include "rttr/detail/misc/utility.h"
+
+#include <algorithm>
+#include <mutex>
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static inline type get_arg_type(const type& t) noexcept
+{
+    return t;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static inline type get_arg_type(const argument& arg) noexcept
+{
+    return arg.get_type();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+static std::size_t generate_resolution_hash(method_resolution_cache::match_kind kind, string_view name,
+                                            const std::vector<T>& args) noexcept
+{
+    std::size_t hash_value = generate_hash(name.data(), name.length());
+    hash_value ^= static_cast<std::size_t>(kind) + 0x9e3779b9 + (hash_value << 6) + (hash_value >> 2);
+    for (const auto& arg : args)
+    {
+        const auto id = static_cast<std::size_t>(get_arg_type(arg).get_id());
+        hash_value ^= id + 0x9e3779b9 + (hash_value << 6) + (hash_value >> 2);
+    }
+
+    return hash_value;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+static bool is_same_arg_list(const std::vector<type>& arg_types, const std::vector<T>& args) noexcept
+{
+    if (arg_types.size() != args.size())
+        return false;
+
+    for (std::size_t i = 0; i < args.size(); ++i)
+    {
+        if (arg_types[i] != get_arg_type(args[i]))
+            return false;
+    }
+
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+bool method_resolution_cache::find_impl(match_kind kind, string_view name, const std::vector<T>& args, method& result) const
+{
+    const auto hash_value = generate_resolution_hash(kind, name, args);
+
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    auto itr = std::lower_bound(m_entry_list.cbegin(), m_entry_list.cend(), hash_value,
+                                [](const entry& item, std::size_t value) { return item.m_hash_value < value; });
+    for (; itr != m_entry_list.cend() && itr->m_hash_value == hash_value; ++itr)
+    {
+        if (itr->m_kind == kind && name == itr->m_name && is_same_arg_list(itr->m_arg_types, args))
+        {
+            result = itr->m_method;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+void method_resolution_cache::insert_impl(match_kind kind, string_view name, const std::vector<T>& args, const method& result)
+{
+    // a failed resolution is not cached, the names of a lookup are not limited to the registered ones
+    if (!result)
+        return;
+
+    std::vector<type> arg_types;
+    arg_types.reserve(args.size());
+    for (const auto& arg : args)
+        arg_types.push_back(get_arg_type(arg));
+
+    entry new_entry{generate_resolution_hash(kind, name, args), kind, name.to_string(), std::move(arg_types), result};
+
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    if (m_entry_list.size() >= max_entry_count)
+        return;
+
+    auto itr = std::lower_bound(m_entry_list.begin(), m_entry_list.end(), new_entry.m_hash_value,
+                                [](const entry& item, std::size_t value) { return item.m_hash_value < value; });
+    for (; itr != m_entry_list.end() && itr->m_hash_value == new_entry.m_hash_value; ++itr)
+    {
+        // another thread was faster
+        if (itr->m_kind == kind && name == itr->m_name && is_same_arg_list(itr->m_arg_types, args))
+            return;
+    }
+
+    m_entry_list.insert(itr, std::move(new_entry));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool method_resolution_cache::find(match_kind kind, string_view name, const std::vector<type>& arg_types, method& result) const
+{
+    return find_impl(kind, name, arg_types, result);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool method_resolution_cache::find(match_kind kind, string_view name, const std::vector<argument>& args, method& result) const
+{
+    return find_impl(kind, name, args, result);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void method_resolution_cache::insert(match_kind kind, string_view name, const std::vector<type>& arg_types, const method& result)
+{
+    insert_impl(kind, name, arg_types, result);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void method_resolution_cache::insert(match_kind kind, string_view name, const std::vector<argument>& args, const method& result)
+{
+    insert_impl(kind, name, args, result);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void method_resolution_cache::clear()
+{
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    m_entry_list.clear();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
@@ -0,0 +1,113 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_METHOD_RESOLUTION_CACHE_H_
+#define RTTR_METHOD_RESOLUTION_CACHE_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/type.h"
+#include "rttr/argument.h"
+#include "rttr/method.h"
+#include "rttr/string_view.h"
+
+#include <string>
+#include <vector>
+#include <shared_mutex>
+
+namespace rttr
+{
+namespace detail
+{
+
+/*!
+ * The \ref method_resolution_cache class memoizes the overload resolution of one class,
+ * i.e. which method is selected for a given method name and a given list of argument types.
+ *
+ * Only successful resolutions are stored, so probing for many unknown names does not grow the cache;
+ * the number of entries is limited to \ref max_entry_count.
+ * The cache has to be cleared, whenever the method list of the class changes.
+ *
+ * \remark All member functions can be called concurrently from different threads.
+ */
+class RTTR_LOCAL method_resolution_cache
+{
+public:
+    //! Determines how the argument types are matched against the parameter list of a method.
+    enum class match_kind : int
+    {
+        type_list,  //!< The types have to match exactly, see \ref compare_with_type_list
+        arg_list    //!< Missing arguments can be covered by default values, see \ref compare_with_arg_list
+    };
+
+    //! The maximum number of cached resolutions; when it is reached, further resolutions are not cached anymore.
+    static constexpr std::size_t max_entry_count = 256;
+
+    /*!
+     * \brief Searches for a cached resolution of the method with the name \p name and the given arguments.
+     *
+     * \return `true`, when an entry was found, which is then copied to \p result; otherwise `false`.
+     */
+    bool find(match_kind kind, string_view name, const std::vector<type>& arg_types, method& result) const;
+    bool find(match_kind kind, string_view name, const std::vector<argument>& args, method& result) const;
+
+    /*!
+     * \brief Stores the resolved method \p result for the method name \p name and the given arguments.
+     *
+     * Nothing is stored, when \p result is invalid or the cache is full.
+     */
+    void insert(match_kind kind, string_view name, const std::vector<type>& arg_types, const method& result);
+    void insert(match_kind kind, string_view name, const std::vector<argument>& args, const method& result);
+
+    /*!
+     * \brief Removes all cached entries.
+     */
+    void clear();
+
+private:
+    struct entry
+    {
+        std::size_t         m_hash_value;
+        match_kind          m_kind;
+        std::string         m_name;
+        std::vector<type>   m_arg_types;
+        method              m_method;
+    };
+
+    template<typename T>
+    bool find_impl(match_kind kind, string_view name, const std::vector<T>& args, method& result) const;
+
+    template<typename T>
+    void insert_impl(match_kind kind, string_view name, const std::vector<T>& args, const method& result);
+
+    std::vector<entry>          m_entry_list; // sorted by hash value
+    mutable std::shared_mutex   m_mutex;
+};
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_METHOD_RESOLUTION_CACHE_H_
@@ -33,6 +33,7 @@
 #include "rttr/detail/misc/function_traits.h"
 #include "rttr/detail/type/accessor_type.h"
 #include "rttr/detail/method/method_accessor.h"
+#include "rttr/detail/method/typed_method_invoker.h"
 #include "rttr/detail/default_arguments/default_arguments.h"
 #include "rttr/detail/default_arguments/invoke_with_defaults.h"
 #include "rttr/detail/parameter_info/parameter_infos.h"
@@ -85,6 +86,7 @@ class method_wrapper<F, Declaring_Type, Acc_Level, Policy, default_args<>, param
         array_range<parameter_info> get_parameter_infos()   const noexcept { return array_range<parameter_info>(const_cast<decltype(m_param_info_list)&>(m_param_info_list).data(),
                                                                                                        m_param_info_list.size()); }
         variant get_metadata(const variant& key)            const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        const variant* get_metadata_value(const metadata_key& key) const noexcept { return metadata_handler<Metadata_Count>::get_metadata_value(key); }
 
         variant invoke(instance& object) const
         {
@@ -120,6 +122,11 @@ class method_wrapper<F, Declaring_Type, Acc_Level, Policy, default_args<>, param
             return method_accessor<F, Policy>::invoke_variadic(m_func_acc, object, args);
         }
 
+        typed_method_invoker get_typed_invoker(const type& signature) const noexcept
+        {
+            return get_typed_method_invoker(m_func_acc, signature);
+        }
+
         void visit(visitor& visitor, const method& meth) const noexcept
         {
             auto obj = make_method_info<Declaring_Type, Policy, F>(meth, m_func_acc);
@@ -168,6 +175,7 @@ class method_wrapper<F, Declaring_Type, Acc_Level, Policy, default_args<Default_
         array_range<parameter_info> get_parameter_infos()   const noexcept { return array_range<parameter_info>(const_cast<decltype(m_param_info_list)&>(m_param_info_list).data(),
                                                                                                        m_param_info_list.size()); }
         variant get_metadata(const variant& key)            const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        const variant* get_metadata_value(const metadata_key& key) const noexcept { return metadata_handler<Metadata_Count>::get_metadata_value(key); }
 
         variant invoke(instance& object) const
         {
@@ -206,6 +214,11 @@ class method_wrapper<F, Declaring_Type, Acc_Level, Policy, default_args<Default_
                 return variant();
         }
 
+        typed_method_invoker get_typed_invoker(const type& signature) const noexcept
+        {
+            return get_typed_method_invoker(m_func_acc, signature);
+        }
+
         void visit(visitor& visitor, const method& meth) const noexcept
         {
             auto obj = make_method_info<Declaring_Type, Policy, F>(meth, m_func_acc);
@@ -244,6 +257,7 @@ class method_wrapper<F, Declaring_Type, Acc_Level, Policy, default_args<>, param
         access_levels get_access_level()                    const noexcept { return Acc_Level;                                       }
         array_range<parameter_info> get_parameter_infos()   const noexcept { return array_range<parameter_info>();                   }
         variant get_metadata(const variant& key)            const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        const variant* get_metadata_value(const metadata_key& key) const noexcept { return metadata_handler<Metadata_Count>::get_metadata_value(key); }
 
         variant invoke(instance& object) const
         {
@@ -279,6 +293,11 @@ class method_wrapper<F, Declaring_Type, Acc_Level, Policy, default_args<>, param
             return method_accessor<F, Policy>::invoke_variadic(m_func_acc, object, args);
         }
 
+        typed_method_invoker get_typed_invoker(const type& signature) const noexcept
+        {
+            return get_typed_method_invoker(m_func_acc, signature);
+        }
+
         void visit(visitor& visitor, const method& meth) const noexcept
         {
             auto obj = make_method_info<Declaring_Type, Policy, F>(meth, m_func_acc);
@@ -321,6 +340,7 @@ class method_wrapper<F, Declaring_Type, Acc_Level, Policy, default_args<Default_
         access_levels get_access_level()                    const noexcept { return Acc_Level;                                       }
         array_range<parameter_info> get_parameter_infos()   const noexcept { return array_range<parameter_info>();                   }
         variant get_metadata(const variant& key)            const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        const variant* get_metadata_value(const metadata_key& key) const noexcept { return metadata_handler<Metadata_Count>::get_metadata_value(key); }
 
         variant invoke(instance& object) const
         {
@@ -359,6 +379,11 @@ class method_wrapper<F, Declaring_Type, Acc_Level, Policy, default_args<Default_
                 return variant();
         }
 
+        typed_method_invoker get_typed_invoker(const type& signature) const noexcept
+        {
+            return get_typed_method_invoker(m_func_acc, signature);
+        }
+
         void visit(visitor& visitor, const method& meth) const noexcept
         {
             auto obj = make_method_info<Declaring_Type, Policy, F>(meth, m_func_acc);
@@ -171,6 +171,13 @@ variant method_wrapper_base::get_metadata(const variant& key) const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+const variant* method_wrapper_base::get_metadata_value(const metadata_key& key) const noexcept
+{
+    return nullptr;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 
 variant method_wrapper_base::invoke(instance& object) const
 {
@@ -231,6 +238,13 @@ variant method_wrapper_base::invoke_variadic(const instance& object, std::vector
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+typed_method_invoker method_wrapper_base::get_typed_invoker(const type& signature) const noexcept
+{
+    return typed_method_invoker();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 void method_wrapper_base::visit(visitor& visitor, const method& m) const noexcept
 {
 
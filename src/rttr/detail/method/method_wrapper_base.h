@@ -30,6 +30,7 @@
 
 #include "rttr/detail/base/core_prerequisites.h"
 #include "rttr/detail/metadata/metadata_handler.h"
+#include "rttr/detail/method/typed_method_invoker.h"
 #include "rttr/type.h"
 #include "rttr/variant.h"
 #include "rttr/array_range.h"
@@ -75,6 +76,7 @@ class RTTR_API method_wrapper_base
         virtual std::vector<bool> get_is_const() const noexcept;
         virtual array_range<parameter_info> get_parameter_infos() const noexcept;
         virtual variant get_metadata(const variant& key) const;
+        virtual const variant* get_metadata_value(const metadata_key& key) const noexcept;
 
         virtual variant invoke(instance& object) const;
         virtual variant invoke(instance& object, argument& arg1) const;
@@ -89,6 +91,8 @@ class RTTR_API method_wrapper_base
 
         virtual variant invoke_variadic(const instance& object, std::vector<argument>& args) const;
 
+        virtual typed_method_invoker get_typed_invoker(const type& signature) const noexcept;
+
         virtual void visit(visitor& visitor, const method& m) const noexcept;
     protected:
         void init() noexcept;
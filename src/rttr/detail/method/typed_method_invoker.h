@@ -0,0 +1,149 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_TYPED_METHOD_INVOKER_H_
+#define RTTR_TYPED_METHOD_INVOKER_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/misc/function_traits.h"
+#include "rttr/type.h"
+
+#include <functional>
+#include <tuple>
+#include <type_traits>
+
+namespace rttr
+{
+namespace detail
+{
+
+/*!
+ * A type erased call target for a \ref method_handle.
+ *
+ * \p func points to a function of type `R(*)(const void*, Args...)`, which is invoked with \p data as first argument.
+ */
+struct typed_method_invoker
+{
+    using erased_func = void(*)();
+
+    erased_func func = nullptr;
+    const void* data = nullptr;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename R, typename Class_Type, typename Arg_Tuple>
+struct make_typed_method_signature;
+
+template<typename R, typename... Args>
+struct make_typed_method_signature<R, void, std::tuple<Args...>>
+{
+    using type = R(Args...);
+};
+
+template<typename R, typename Class_Type, typename... Args>
+struct make_typed_method_signature<R, Class_Type, std::tuple<Args...>>
+{
+    using type = R(Class_Type, Args...);
+};
+
+template<typename F, typename Class_Type, typename Arg_Tuple>
+struct is_const_member_function;
+
+template<typename F, typename Class_Type, typename... Args>
+struct is_const_member_function<F, Class_Type, std::tuple<Args...>> : std::is_invocable<F, const Class_Type&, Args...>
+{
+};
+
+/*!
+ * Determines the native signature of a registered method accessor \p F.
+ *
+ * A member function `R (C::*)(Args...)` results in `R(C&, Args...)`, a const member function in `R(const C&, Args...)`;
+ * free functions and function objects keep their signature `R(Args...)`.
+ */
+template<typename F, bool Is_Member = std::is_member_function_pointer<F>::value>
+struct typed_method_signature
+{
+    using type = typename make_typed_method_signature<typename function_traits<F>::return_type, void,
+                                                      typename function_traits<F>::arg_types>::type;
+    using mutable_type = type;
+};
+
+template<typename F>
+struct typed_method_signature<F, true>
+{
+    using class_type = typename function_traits<F>::class_type;
+    using return_type = typename function_traits<F>::return_type;
+    using arg_types = typename function_traits<F>::arg_types;
+
+    using mutable_type = typename make_typed_method_signature<return_type, class_type&, arg_types>::type;
+    using type = conditional_t<is_const_member_function<F, class_type, arg_types>::value,
+                               typename make_typed_method_signature<return_type, const class_type&, arg_types>::type,
+                               mutable_type>;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename F, typename Signature>
+struct typed_method_thunk;
+
+template<typename F, typename R, typename... Args>
+struct typed_method_thunk<F, R(Args...)>
+{
+    static R invoke(const void* data, Args... args)
+    {
+        return std::invoke(*static_cast<const F*>(data), std::forward<Args>(args)...);
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Returns the call target for the method accessor \p func, when \p signature is the \ref type of a function pointer
+ * to its native signature (see \ref typed_method_signature); otherwise an empty invoker.
+ *
+ * A const member function can also be called with a non-const object reference.
+ */
+template<typename F>
+typed_method_invoker get_typed_method_invoker(const F& func, const type& signature) noexcept
+{
+    using signature_type = typename typed_method_signature<F>::type;
+    using mutable_signature_type = typename typed_method_signature<F>::mutable_type;
+
+    if (signature == type::get<signature_type*>())
+        return {reinterpret_cast<typed_method_invoker::erased_func>(&typed_method_thunk<F, signature_type>::invoke), &func};
+
+    if (!std::is_same<signature_type, mutable_signature_type>::value && signature == type::get<mutable_signature_type*>())
+        return {reinterpret_cast<typed_method_invoker::erased_func>(&typed_method_thunk<F, mutable_signature_type>::invoke), &func};
+
+    return {};
+}
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_TYPED_METHOD_INVOKER_H_
@@ -132,7 +132,15 @@ class flat_map
         template<typename T>
         const_iterator find(const T& key) const
         {
-            const auto hash_value = Hash<T>()(key);
+            return find(key, Hash<T>()(key));
+        }
+
+        /*!
+         * \brief Finds the value of the given \p key, whose hash value \p hash_value was already computed.
+         */
+        template<typename T>
+        const_iterator find(const T& key, hash_type hash_value) const
+        {
             auto itr = std::lower_bound(m_key_list.begin(), m_key_list.end(),
                                         hash_value,
                                         typename key_data_type::order());
@@ -214,6 +222,43 @@ class flat_map
             m_value_list.clear();
         }
 
+        /*!
+         * \brief Replaces the content with the key-value pairs of the range [first, last).
+         *        The data is sorted only once, so this is much cheaper than calling \ref insert() for every item.
+         *        Like \ref insert(), a key which is already contained is ignored, i.e. the first occurrence wins.
+         */
+        template<typename Itr>
+        void assign(Itr first, Itr last)
+        {
+            std::vector<std::pair<key_data_type, Value>> tmp_list;
+            for (; first != last; ++first)
+                tmp_list.emplace_back(key_data_type{first->first, has_type()(first->first)}, first->second);
+
+            std::stable_sort(tmp_list.begin(), tmp_list.end(),
+                             [](const std::pair<key_data_type, Value>& left, const std::pair<key_data_type, Value>& right)
+                             { return typename key_data_type::order()(left.first, right.first); });
+
+            clear();
+            m_key_list.reserve(tmp_list.size());
+            m_value_list.reserve(tmp_list.size());
+
+            auto bucket_begin = m_key_list.size();
+            for (auto& item : tmp_list)
+            {
+                if (bucket_begin == m_key_list.size() || m_key_list[bucket_begin].m_hash_value != item.first.m_hash_value)
+                    bucket_begin = m_key_list.size();
+
+                const auto bucket_end = m_key_list.begin() + static_cast<std::ptrdiff_t>(m_key_list.size());
+                const auto found = std::find_if(m_key_list.begin() + static_cast<std::ptrdiff_t>(bucket_begin), bucket_end,
+                                                [&item](const key_data_type& key) { return Compare()(key.m_key, item.first.m_key); });
+                if (found != bucket_end)
+                    continue;
+
+                m_key_list.push_back(std::move(item.first));
+                m_value_list.push_back(std::move(item.second));
+            }
+        }
+
         const std::vector<Value>& value_data() const
         {
             return m_value_list;
@@ -32,7 +32,11 @@
 
 #include "rttr/variant.h"
 
+#include <array>
+#include <cstddef>
+#include <iterator>
 #include <memory>
+#include <new>
 #include <type_traits>
 
 namespace rttr
@@ -40,7 +44,14 @@ namespace rttr
 namespace detail
 {
 
-using iterator_data = std::aligned_storage<sizeof(double)>::type;
+/*!
+ * The inline storage for the iterator of a container, used by the sequential and associative view.
+ * It is big enough to hold the iterators of all standard containers, also with checked iterators.
+ * Bigger iterators are stored in a memory block of the \ref iterator_pool.
+ */
+using iterator_data = std::aligned_storage<6 * sizeof(void*),
+                                           (std::alignment_of<void*>::value > std::alignment_of<double>::value)
+                                           ? std::alignment_of<void*>::value : std::alignment_of<double>::value>::type;
 
 template<typename T, bool Can_Place = (sizeof(T) <= sizeof(iterator_data)) &&
                                       (std::alignment_of<T>::value <= std::alignment_of<iterator_data>::value)>
@@ -82,11 +93,69 @@ struct iterator_wrapper_small
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+/*!
+ * A thread local cache of memory blocks with the size \p Size and the alignment \p Align.
+ *
+ * Released blocks are kept for reuse, so that copying and destroying an iterator,
+ * which does not fit into \ref iterator_data, does not allocate once the cache is warm.
+ */
+template<std::size_t Size, std::size_t Align>
+class iterator_pool
+{
+    public:
+        static void* allocate()
+        {
+            auto& cache = get_cache();
+            if (cache.m_count > 0)
+                return cache.m_blocks[--cache.m_count];
+
+            return ::operator new(Size, std::align_val_t(Align));
+        }
+
+        static void deallocate(void* block) noexcept
+        {
+            auto& cache = get_cache();
+            if (!cache.m_destroyed && cache.m_count < max_cached_blocks)
+                cache.m_blocks[cache.m_count++] = block;
+            else
+                ::operator delete(block, std::align_val_t(Align));
+        }
+
+    private:
+        static constexpr std::size_t max_cached_blocks = 16;
+
+        struct block_cache
+        {
+            ~block_cache()
+            {
+                for (std::size_t i = 0; i < m_count; ++i)
+                    ::operator delete(m_blocks[i], std::align_val_t(Align));
+
+                m_count = 0;
+                // an iterator can still be destroyed afterwards during thread exit
+                m_destroyed = true;
+            }
+
+            std::array<void*, max_cached_blocks> m_blocks;
+            std::size_t m_count = 0;
+            bool m_destroyed = false;
+        };
+
+        static block_cache& get_cache() noexcept
+        {
+            static thread_local block_cache cache;
+            return cache;
+        }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 template<typename Itr>
 struct iterator_wrapper_big
 {
     using type = Itr;
     using iterator = Itr;
+    using pool = iterator_pool<sizeof(Itr), std::alignment_of<Itr>::value>;
 
     static const Itr& get_iterator(const iterator_data& data)
     {
@@ -100,18 +169,19 @@ struct iterator_wrapper_big
 
     static void create(iterator_data& itr_tgt, const iterator& itr_src)
     {
-        reinterpret_cast<Itr*&>(itr_tgt) = new iterator(itr_src);
+        reinterpret_cast<Itr*&>(itr_tgt) = new (pool::allocate()) iterator(itr_src);
     }
 
     static void create(iterator_data& itr_tgt, const iterator_data& itr_src)
     {
-        reinterpret_cast<Itr*&>(itr_tgt) = new iterator(*reinterpret_cast<Itr* const &>(itr_src));
+        reinterpret_cast<Itr*&>(itr_tgt) = new (pool::allocate()) iterator(get_iterator(itr_src));
     }
 
     static void destroy(iterator_data& itr)
     {
         auto& it = get_iterator(itr);
-        delete &it;
+        it.~Itr();
+        pool::deallocate(&it);
     }
 };
 
@@ -0,0 +1,218 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_PERFECT_HASH_MAP_H_
+#define RTTR_PERFECT_HASH_MAP_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+namespace rttr
+{
+namespace detail
+{
+
+/*!
+ * \brief The perfect_hash_map class is an immutable map, which finds every key with exactly one probe.
+ *
+ * The table is build once from a known set of keys with the *hash and displace* scheme:
+ * every key is assigned to a bucket and for every bucket a displacement is searched,
+ * which moves all keys of the bucket into free slots. There is exactly one slot per key (minimal perfect hash),
+ * so the keys and values are stored contiguous in one array.
+ * A key, which was not part of the build set, is rejected by comparing the stored hash value and key.
+ *
+ * The hash values of the keys have to be provided by the caller, so the same hash function as in \ref flat_map
+ * can be used and an already computed hash value (e.g. of a \ref name_key) can be reused for the lookup.
+ */
+template<typename Key, typename Value>
+class perfect_hash_map
+{
+    public:
+        using hash_type = std::size_t;
+
+        struct item
+        {
+            Key         m_key;
+            hash_type   m_hash_value;
+            Value       m_value;
+        };
+
+        /*!
+         * \brief Builds the table from the given \p items.
+         *
+         * \return `false`, when two items have the same hash value (e.g. because the key occurs twice),
+         *         then the map stays empty.
+         */
+        bool build(std::vector<item> items)
+        {
+            clear();
+            if (items.empty())
+                return true;
+
+            std::sort(items.begin(), items.end(), [](const item& left, const item& right)
+                                                  { return (left.m_hash_value < right.m_hash_value); });
+            const auto duplicate = std::adjacent_find(items.cbegin(), items.cend(), [](const item& left, const item& right)
+                                                      { return (left.m_hash_value == right.m_hash_value); });
+            if (duplicate != items.cend())
+                return false;
+
+            const std::size_t item_count = items.size();
+            std::size_t bucket_count = 1;
+            while (bucket_count * keys_per_bucket < item_count)
+                bucket_count *= 2;
+
+            std::vector<std::vector<std::size_t>> buckets(bucket_count);
+            for (std::size_t index = 0; index < item_count; ++index)
+                buckets[get_bucket(items[index].m_hash_value, bucket_count)].push_back(index);
+
+            // the biggest buckets are placed first, while the most slots are still free
+            std::vector<std::size_t> bucket_order(bucket_count);
+            for (std::size_t index = 0; index < bucket_count; ++index)
+                bucket_order[index] = index;
+            std::stable_sort(bucket_order.begin(), bucket_order.end(), [&buckets](std::size_t left, std::size_t right)
+                                                                       { return (buckets[left].size() > buckets[right].size()); });
+
+            std::vector<std::size_t> item_of_slot(item_count, item_count);
+            std::vector<std::size_t> bucket_slots;
+            m_displacements.assign(bucket_count, 0);
+            for (const auto bucket_index : bucket_order)
+            {
+                const auto& bucket = buckets[bucket_index];
+                if (bucket.empty())
+                    break;
+
+                std::uint32_t displacement = 0;
+                for (; displacement < max_displacement; ++displacement)
+                {
+                    bucket_slots.clear();
+                    for (const auto index : bucket)
+                    {
+                        const auto slot = get_slot(items[index].m_hash_value, displacement, item_count);
+                        if (item_of_slot[slot] != item_count ||
+                            std::find(bucket_slots.cbegin(), bucket_slots.cend(), slot) != bucket_slots.cend())
+                            break;
+
+                        bucket_slots.push_back(slot);
+                    }
+
+                    if (bucket_slots.size() == bucket.size())
+                        break;
+                }
+
+                if (displacement == max_displacement)
+                {
+                    clear();
+                    return false;
+                }
+
+                m_displacements[bucket_index] = displacement;
+                for (std::size_t index = 0; index < bucket.size(); ++index)
+                    item_of_slot[bucket_slots[index]] = bucket[index];
+            }
+
+            m_items.reserve(item_count);
+            for (const auto index : item_of_slot)
+                m_items.push_back(std::move(items[index]));
+
+            return true;
+        }
+
+        /*!
+         * \brief Returns a pointer to the value of \p key, whose hash value is \p hash_value;
+         *        or `nullptr`, when the key is not contained.
+         */
+        template<typename T>
+        const Value* find(const T& key, hash_type hash_value) const noexcept
+        {
+            if (m_items.empty())
+                return nullptr;
+
+            const auto displacement = m_displacements[get_bucket(hash_value, m_displacements.size())];
+            const auto& found = m_items[get_slot(hash_value, displacement, m_items.size())];
+            if (found.m_hash_value == hash_value && found.m_key == key)
+                return &found.m_value;
+
+            return nullptr;
+        }
+
+        std::size_t size() const noexcept
+        {
+            return m_items.size();
+        }
+
+        bool empty() const noexcept
+        {
+            return m_items.empty();
+        }
+
+        void clear() noexcept
+        {
+            m_displacements.clear();
+            m_items.clear();
+        }
+
+        //! Returns all items, in the order of their slots.
+        const std::vector<item>& get_items() const noexcept
+        {
+            return m_items;
+        }
+
+    private:
+        //! The finalizer of *splitmix64*; it distributes also the poorly mixed bits of a FNV hash value.
+        static std::uint64_t mix(std::uint64_t value) noexcept
+        {
+            value = (value ^ (value >> 30)) * UINT64_C(0xbf58476d1ce4e5b9);
+            value = (value ^ (value >> 27)) * UINT64_C(0x94d049bb133111eb);
+            return value ^ (value >> 31);
+        }
+
+        static std::size_t get_bucket(hash_type hash_value, std::size_t bucket_count) noexcept
+        {
+            return static_cast<std::size_t>(mix(hash_value)) & (bucket_count - 1);
+        }
+
+        static std::size_t get_slot(hash_type hash_value, std::uint32_t displacement, std::size_t slot_count) noexcept
+        {
+            const auto value = mix(hash_value ^ (UINT64_C(0x9e3779b97f4a7c15) * (std::uint64_t(displacement) + 1)));
+            return static_cast<std::size_t>(value % slot_count);
+        }
+
+        static constexpr std::size_t    keys_per_bucket     = 2;
+        static constexpr std::uint32_t  max_displacement    = 1u << 20;
+
+        std::vector<std::uint32_t>  m_displacements;
+        std::vector<item>           m_items;
+};
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_PERFECT_HASH_MAP_H_
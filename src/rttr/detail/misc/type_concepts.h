@@ -194,6 +194,28 @@ concept CompareFunction = requires(const Compare& c, const Key& a, const Key& b)
     { c(a, b) } -> std::convertible_to<bool>;
 };
 
+// Sequential container concepts
+template<typename Mapper, typename Container>
+concept HasContiguousData = requires(Container& container) {
+    { Mapper::get_contiguous_data(container) } -> PointerType;
+};
+
+template<typename Mapper, typename Container, typename Value>
+concept HasRangeInsert = requires(Container& container, const Value* data, const typename Mapper::itr_t& itr) {
+    { Mapper::insert_range(container, data, data, itr) } -> std::same_as<typename Mapper::itr_t>;
+};
+
+template<typename Mapper, typename Container>
+concept HasRangeErase = requires(Container& container, const typename Mapper::itr_t& itr) {
+    { Mapper::erase_range(container, itr, itr) } -> std::same_as<typename Mapper::itr_t>;
+};
+
+// Container concepts shared by sequential and associative mappers
+template<typename Mapper, typename Container>
+concept HasReserve = requires(Container& container, std::size_t size) {
+    { Mapper::reserve(container, size) } -> std::convertible_to<bool>;
+};
+
 } // namespace rttr::detail
 
 #endif // RTTR_TYPE_CONCEPTS_H_
\ No newline at end of file
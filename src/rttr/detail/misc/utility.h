@@ -472,8 +472,10 @@ static inline std::shared_ptr<T> create_if_empty(const std::shared_ptr<T>& obj)
 
 /*!
  * \brief Generates a hash value for continuous sequence of char's
+ *
+ * The function is `constexpr`, so the hash of a string literal can be computed at compile time (see \ref name_key).
  */
-inline static std::size_t generate_hash(const char* text, std::size_t length)
+constexpr static std::size_t generate_hash(const char* text, std::size_t length)
 {
     const std::size_t  magic_prime = static_cast<std::size_t>(0x01000193);
     std::size_t               hash = static_cast<std::size_t>(0xcbf29ce4);
@@ -25,8 +25,8 @@
 *                                                                                   *
 *************************************************************************************/
 
-#ifndef RTTR_PROPERTY_ACCESSOR_H_
-#define RTTR_PROPERTY_ACCESSOR_H_
+#ifndef RTTR_DETAIL_PROPERTY_ACCESSOR_H_
+#define RTTR_DETAIL_PROPERTY_ACCESSOR_H_
 
 namespace rttr
 {
@@ -77,4 +77,4 @@ struct property_accessor<T(*)[N]>
 } // end namespace detail
 } // end namespace rttr
 
-#endif // RTTR_PROPERTY_ACCESSOR_H_
+#endif // RTTR_DETAIL_PROPERTY_ACCESSOR_H_
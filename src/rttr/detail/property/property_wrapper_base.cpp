@@ -111,6 +111,13 @@ variant property_wrapper_base::get_metadata(const variant& key) const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+const variant* property_wrapper_base::get_metadata_value(const metadata_key& key) const noexcept
+{
+    return nullptr;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 bool property_wrapper_base::set_value(instance& object, argument& arg) const
 {
     return false;
@@ -132,5 +139,12 @@ void property_wrapper_base::visit(visitor& visitor, property prop) const noexcep
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+typed_property_invoker property_wrapper_base::get_typed_accessor(const type& key) const noexcept
+{
+    return typed_property_invoker();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 } // end namespace detail
 } // end namespace rttr
@@ -30,6 +30,7 @@
 
 #include "rttr/detail/base/core_prerequisites.h"
 #include "rttr/detail/metadata/metadata_handler.h"
+#include "rttr/detail/property/typed_property_invoker.h"
 #include "rttr/type.h"
 #include "rttr/variant.h"
 #include "rttr/access_levels.h"
@@ -74,12 +75,16 @@ class RTTR_API property_wrapper_base
 
         virtual variant get_metadata(const variant& key) const;
 
+        virtual const variant* get_metadata_value(const metadata_key& key) const noexcept;
+
         virtual bool set_value(instance& object, argument& arg) const;
 
         virtual variant get_value(instance& object) const;
 
         virtual void visit(visitor& visitor, property prop) const noexcept;
 
+        virtual typed_property_invoker get_typed_accessor(const type& key) const noexcept;
+
     protected:
         void init() noexcept;
 
@@ -62,6 +62,7 @@ class property_wrapper<member_func_ptr, Declaring_Typ, Getter, Setter, Acc_Level
         type get_type()     const noexcept                 { return type::get<return_type>(); }
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        const variant* get_metadata_value(const metadata_key& key) const noexcept { return metadata_handler<Metadata_Count>::get_metadata_value(key); }
 
         bool set_value(instance& object, argument& arg) const
         {
@@ -88,6 +89,11 @@ class property_wrapper<member_func_ptr, Declaring_Typ, Getter, Setter, Acc_Level
             visitor_iterator<Visitor_List>::visit(visitor, make_property_getter_setter_visitor_invoker(obj));
         }
 
+        typed_property_invoker get_typed_accessor(const type& key) const noexcept
+        {
+            return get_member_func_invoker(m_getter, m_setter, key);
+        }
+
     private:
         Getter  m_getter;
         Setter  m_setter;
@@ -123,6 +129,7 @@ class property_wrapper<member_func_ptr, Declaring_Typ, Getter, void, Acc_Level,
         type get_type()     const noexcept                 { return type::get<return_type>(); }
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        const variant* get_metadata_value(const metadata_key& key) const noexcept { return metadata_handler<Metadata_Count>::get_metadata_value(key); }
 
         bool set_value(instance& object, argument& arg) const
         {
@@ -143,6 +150,11 @@ class property_wrapper<member_func_ptr, Declaring_Typ, Getter, void, Acc_Level,
             visitor_iterator<Visitor_List>::visit(visitor, make_property_visitor_invoker<read_only>(obj));
         }
 
+        typed_property_invoker get_typed_accessor(const type& key) const noexcept
+        {
+            return get_member_func_invoker(m_getter, key);
+        }
+
     private:
         Getter  m_getter;
 };
@@ -185,6 +197,7 @@ class property_wrapper<member_func_ptr, Declaring_Typ, Getter, Setter, Acc_Level
         type get_type()     const noexcept                 { return type::get<typename std::remove_reference<return_type>::type*>(); }
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        const variant* get_metadata_value(const metadata_key& key) const noexcept { return metadata_handler<Metadata_Count>::get_metadata_value(key); }
 
         bool set_value(instance& object, argument& arg) const
         {
@@ -212,6 +225,11 @@ class property_wrapper<member_func_ptr, Declaring_Typ, Getter, Setter, Acc_Level
             visitor_iterator<Visitor_List>::visit(visitor, make_property_getter_setter_visitor_invoker(obj));
         }
 
+        typed_property_invoker get_typed_accessor(const type& key) const noexcept
+        {
+            return get_member_func_invoker(m_getter, m_setter, key);
+        }
+
     private:
         Getter  m_getter;
         Setter  m_setter;
@@ -251,6 +269,7 @@ class property_wrapper<member_func_ptr, Declaring_Typ, Getter, void, Acc_Level,
         type get_type()     const noexcept                 { return type::get<policy_type>(); }
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        const variant* get_metadata_value(const metadata_key& key) const noexcept { return metadata_handler<Metadata_Count>::get_metadata_value(key); }
 
         bool set_value(instance& object, argument& arg) const
         {
@@ -271,6 +290,11 @@ class property_wrapper<member_func_ptr, Declaring_Typ, Getter, void, Acc_Level,
             visitor_iterator<Visitor_List>::visit(visitor, make_property_visitor_invoker<read_only>(obj));
         }
 
+        typed_property_invoker get_typed_accessor(const type& key) const noexcept
+        {
+            return get_member_func_invoker(m_getter, key);
+        }
+
     private:
         Getter  m_getter;
 };
@@ -313,6 +337,7 @@ class property_wrapper<member_func_ptr, Declaring_Typ, Getter, Setter, Acc_Level
         type get_type()     const noexcept                 { return type::get< std::reference_wrapper<remove_reference_t<return_type>> >(); }
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        const variant* get_metadata_value(const metadata_key& key) const noexcept { return metadata_handler<Metadata_Count>::get_metadata_value(key); }
 
         bool set_value(instance& object, argument& arg) const
         {
@@ -340,6 +365,11 @@ class property_wrapper<member_func_ptr, Declaring_Typ, Getter, Setter, Acc_Level
             visitor_iterator<Visitor_List>::visit(visitor, make_property_getter_setter_visitor_invoker(obj));
         }
 
+        typed_property_invoker get_typed_accessor(const type& key) const noexcept
+        {
+            return get_member_func_invoker(m_getter, m_setter, key);
+        }
+
     private:
         Getter  m_getter;
         Setter  m_setter;
@@ -379,6 +409,7 @@ class property_wrapper<member_func_ptr, Declaring_Typ, Getter, void, Acc_Level,
         type get_type()     const noexcept                 { return type::get<policy_type>(); }
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        const variant* get_metadata_value(const metadata_key& key) const noexcept { return metadata_handler<Metadata_Count>::get_metadata_value(key); }
 
         bool set_value(instance& object, argument& arg) const
         {
@@ -399,6 +430,11 @@ class property_wrapper<member_func_ptr, Declaring_Typ, Getter, void, Acc_Level,
             visitor_iterator<Visitor_List>::visit(visitor, make_property_visitor_invoker<read_only>(obj));
         }
 
+        typed_property_invoker get_typed_accessor(const type& key) const noexcept
+        {
+            return get_member_func_invoker(m_getter, key);
+        }
+
     private:
         Getter  m_getter;
 };
@@ -54,6 +54,7 @@ class property_wrapper<member_object_ptr, Declaring_Typ, A(C::*), void, Acc_Leve
         type get_type()     const noexcept                 { return type::get<A>(); }
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        const variant* get_metadata_value(const metadata_key& key) const noexcept { return metadata_handler<Metadata_Count>::get_metadata_value(key); }
 
         bool set_value(instance& object, argument& arg) const
         {
@@ -78,6 +79,11 @@ class property_wrapper<member_object_ptr, Declaring_Typ, A(C::*), void, Acc_Leve
             visitor_iterator<Visitor_List>::visit(visitor, make_property_visitor_invoker(obj));
         }
 
+        typed_property_invoker get_typed_accessor(const type& key) const noexcept
+        {
+            return get_member_object_invoker(m_acc, is_readonly(), key);
+        }
+
     private:
         accessor m_acc;
 };
@@ -109,6 +115,7 @@ class property_wrapper<member_object_ptr, Declaring_Typ, A(C::*), void, Acc_Leve
         type get_type()     const noexcept                 { return type::get<A>(); }
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        const variant* get_metadata_value(const metadata_key& key) const noexcept { return metadata_handler<Metadata_Count>::get_metadata_value(key); }
 
         bool set_value(instance& object, argument& arg) const
         {
@@ -129,6 +136,11 @@ class property_wrapper<member_object_ptr, Declaring_Typ, A(C::*), void, Acc_Leve
             visitor_iterator<Visitor_List>::visit(visitor, make_property_visitor_invoker<read_only>(obj));
         }
 
+        typed_property_invoker get_typed_accessor(const type& key) const noexcept
+        {
+            return get_member_object_invoker(m_acc, is_readonly(), key);
+        }
+
     private:
         accessor m_acc;
 };
@@ -161,6 +173,7 @@ class property_wrapper<member_object_ptr, Declaring_Typ, A(C::*), void, Acc_Leve
         type get_type()     const noexcept                 { return type::get<A*>(); }
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        const variant* get_metadata_value(const metadata_key& key) const noexcept { return metadata_handler<Metadata_Count>::get_metadata_value(key); }
 
         bool set_value(instance& object, argument& arg) const
         {
@@ -189,6 +202,11 @@ class property_wrapper<member_object_ptr, Declaring_Typ, A(C::*), void, Acc_Leve
             visitor_iterator<Visitor_List>::visit(visitor, make_property_visitor_invoker(obj));
         }
 
+        typed_property_invoker get_typed_accessor(const type& key) const noexcept
+        {
+            return get_member_object_invoker(m_acc, is_readonly(), key);
+        }
+
     private:
         accessor m_acc;
 };
@@ -220,6 +238,7 @@ class property_wrapper<member_object_ptr, Declaring_Typ, A(C::*), void, Acc_Leve
         type get_type()     const noexcept                 { return type::get<typename std::add_const<A>::type*>(); }
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        const variant* get_metadata_value(const metadata_key& key) const noexcept { return metadata_handler<Metadata_Count>::get_metadata_value(key); }
 
         bool set_value(instance& object, argument& arg) const
         {
@@ -240,6 +259,11 @@ class property_wrapper<member_object_ptr, Declaring_Typ, A(C::*), void, Acc_Leve
             visitor_iterator<Visitor_List>::visit(visitor, make_property_visitor_invoker<read_only>(obj));
         }
 
+        typed_property_invoker get_typed_accessor(const type& key) const noexcept
+        {
+            return get_member_object_invoker(m_acc, is_readonly(), key);
+        }
+
     private:
         accessor m_acc;
 };
@@ -272,6 +296,7 @@ class property_wrapper<member_object_ptr, Declaring_Typ, A(C::*), void, Acc_Leve
         type get_type()     const noexcept                 { return type::get<std::reference_wrapper<A>>(); }
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        const variant* get_metadata_value(const metadata_key& key) const noexcept { return metadata_handler<Metadata_Count>::get_metadata_value(key); }
 
         bool set_value(instance& object, argument& arg) const
         {
@@ -296,6 +321,11 @@ class property_wrapper<member_object_ptr, Declaring_Typ, A(C::*), void, Acc_Leve
             visitor_iterator<Visitor_List>::visit(visitor, make_property_visitor_invoker(obj));
         }
 
+        typed_property_invoker get_typed_accessor(const type& key) const noexcept
+        {
+            return get_member_object_invoker(m_acc, is_readonly(), key);
+        }
+
     private:
         accessor m_acc;
 };
@@ -327,6 +357,7 @@ class property_wrapper<member_object_ptr, Declaring_Typ, A(C::*), void, Acc_Leve
         type get_type()     const noexcept                 { return type::get< std::reference_wrapper<add_const_t<A>> >(); }
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        const variant* get_metadata_value(const metadata_key& key) const noexcept { return metadata_handler<Metadata_Count>::get_metadata_value(key); }
 
         bool set_value(instance& object, argument& arg) const
         {
@@ -347,6 +378,11 @@ class property_wrapper<member_object_ptr, Declaring_Typ, A(C::*), void, Acc_Leve
             visitor_iterator<Visitor_List>::visit(visitor, make_property_visitor_invoker<read_only>(obj));
         }
 
+        typed_property_invoker get_typed_accessor(const type& key) const noexcept
+        {
+            return get_member_object_invoker(m_acc, is_readonly(), key);
+        }
+
     private:
         accessor m_acc;
 };
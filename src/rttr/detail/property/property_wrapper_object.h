@@ -53,6 +53,7 @@ class property_wrapper<object_ptr, Declaring_Typ, C*, void, Acc_Level, return_as
         type get_type()     const noexcept                 { return type::get<C>(); }
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        const variant* get_metadata_value(const metadata_key& key) const noexcept { return metadata_handler<Metadata_Count>::get_metadata_value(key); }
 
         bool set_value(instance& object, argument& arg) const
         {
@@ -101,6 +102,7 @@ class property_wrapper<object_ptr, Declaring_Typ, C*, void, Acc_Level, return_as
         type get_type()     const noexcept                 { return type::get<C>(); }
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        const variant* get_metadata_value(const metadata_key& key) const noexcept { return metadata_handler<Metadata_Count>::get_metadata_value(key); }
 
         bool set_value(instance& object, argument& arg) const
         {
@@ -148,6 +150,7 @@ class property_wrapper<object_ptr, Declaring_Typ, C*, void, Acc_Level, return_as
         type get_type()     const noexcept                 { return type::get<C*>(); }
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        const variant* get_metadata_value(const metadata_key& key) const noexcept { return metadata_handler<Metadata_Count>::get_metadata_value(key); }
 
         bool set_value(instance& object, argument& arg) const
         {
@@ -201,6 +204,7 @@ class property_wrapper<object_ptr, Declaring_Typ, C*, void, Acc_Level, return_as
         type get_type()     const noexcept                 { return type::get<typename std::add_const<C>::type*>(); }
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        const variant* get_metadata_value(const metadata_key& key) const noexcept { return metadata_handler<Metadata_Count>::get_metadata_value(key); }
 
         bool set_value(instance& object, argument& arg) const
         {
@@ -248,6 +252,7 @@ class property_wrapper<object_ptr, Declaring_Typ, C*, void, Acc_Level, get_as_re
         type get_type()     const noexcept                 { return type::get< std::reference_wrapper<C> >(); }
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        const variant* get_metadata_value(const metadata_key& key) const noexcept { return metadata_handler<Metadata_Count>::get_metadata_value(key); }
 
         bool set_value(instance& object, argument& arg) const
         {
@@ -296,6 +301,7 @@ class property_wrapper<object_ptr, Declaring_Typ, C*, void, Acc_Level, get_as_re
         type get_type()     const noexcept                 { return type::get< std::reference_wrapper< add_const_t<C>> >(); }
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        const variant* get_metadata_value(const metadata_key& key) const noexcept { return metadata_handler<Metadata_Count>::get_metadata_value(key); }
 
         bool set_value(instance& object, argument& arg) const
         {
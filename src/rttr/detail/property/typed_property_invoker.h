@@ -0,0 +1,204 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_TYPED_PROPERTY_INVOKER_H_
+#define RTTR_TYPED_PROPERTY_INVOKER_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/misc/function_traits.h"
+#include "rttr/type.h"
+
+#include <type_traits>
+
+namespace rttr
+{
+namespace detail
+{
+
+/*!
+ * The type erased access functions of a member property for a \ref property_accessor.
+ *
+ * \p getter points to a function `T(*)(const void*, const C&)`, which is invoked with \p getter_data,
+ * \p setter points to a function `void(*)(const void*, C&, const T&)`, which is invoked with \p setter_data.
+ * When the property is a pointer to a non-const member object, \p member points to the stored `T C::*`;
+ * for a read only property it is only used for reading, i.e. \p setter is still `nullptr`.
+ */
+struct typed_property_invoker
+{
+    using erased_func = void(*)();
+
+    erased_func getter      = nullptr;
+    const void* getter_data = nullptr;
+    erased_func setter      = nullptr;
+    const void* setter_data = nullptr;
+    const void* member      = nullptr;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The key, which identifies the requested accessor of a member property with value type \p T of class \p C.
+ */
+template<typename C, typename T>
+inline type get_typed_property_key() noexcept
+{
+    return type::get<T C::*>();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename C, typename A>
+struct member_object_property_thunk
+{
+    using value_type = typename std::remove_cv<A>::type;
+
+    static value_type get(const void* data, const C& obj)
+    {
+        return obj.*(*static_cast<A C::* const*>(data));
+    }
+
+    static void set(const void* data, C& obj, const value_type& value)
+    {
+        obj.*(*static_cast<A C::* const*>(data)) = value;
+    }
+};
+
+/*!
+ * Returns the accessor for the pointer to member object \p acc, when \p key matches its class and value type.
+ */
+template<typename C, typename A>
+typed_property_invoker get_member_object_invoker(A C::* const& acc, bool read_only, const type& key) noexcept
+{
+    using thunk = member_object_property_thunk<C, A>;
+    using value_type = typename std::remove_cv<A>::type;
+
+    typed_property_invoker result;
+    if constexpr (std::is_array<A>::value)
+        return result;
+
+    if (key != get_typed_property_key<C, value_type>())
+        return result;
+
+    if constexpr (!std::is_array<A>::value && std::is_copy_constructible<value_type>::value)
+    {
+        result.getter       = reinterpret_cast<typed_property_invoker::erased_func>(&thunk::get);
+        result.getter_data  = &acc;
+    }
+
+    if constexpr (!std::is_array<A>::value && !std::is_const<A>::value)
+    {
+        result.member = &acc;
+
+        if constexpr (std::is_copy_assignable<value_type>::value)
+        {
+            if (!read_only)
+            {
+                result.setter       = reinterpret_cast<typed_property_invoker::erased_func>(&thunk::set);
+                result.setter_data  = &acc;
+            }
+        }
+    }
+
+    return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Getter>
+struct member_func_property_getter_thunk
+{
+    using class_type = typename function_traits<Getter>::class_type;
+    using value_type = remove_cv_t<remove_reference_t<typename function_traits<Getter>::return_type>>;
+
+    static value_type get(const void* data, const class_type& obj)
+    {
+        return (obj.*(*static_cast<const Getter*>(data)))();
+    }
+};
+
+template<typename Setter, typename C, typename T>
+struct member_func_property_setter_thunk
+{
+    static void set(const void* data, C& obj, const T& value)
+    {
+        (obj.*(*static_cast<const Setter*>(data)))(value);
+    }
+};
+
+/*!
+ * Returns the accessor for a read only property, which is registered with the member function \p getter,
+ * when \p key matches its class and value type.
+ * The accessor reads from a `const` object, so a \p getter, which is not a `const` member function, has no accessor.
+ */
+template<typename Getter>
+typed_property_invoker get_member_func_invoker(const Getter& getter, const type& key) noexcept
+{
+    using getter_thunk = member_func_property_getter_thunk<Getter>;
+    using class_type = typename getter_thunk::class_type;
+    using value_type = typename getter_thunk::value_type;
+
+    typed_property_invoker result;
+    if (key != get_typed_property_key<class_type, value_type>())
+        return result;
+
+    if constexpr (std::is_copy_constructible<value_type>::value && std::is_invocable<Getter, const class_type&>::value)
+    {
+        result.getter       = reinterpret_cast<typed_property_invoker::erased_func>(&getter_thunk::get);
+        result.getter_data  = &getter;
+    }
+
+    return result;
+}
+
+/*!
+ * Returns the accessor for a property, which is registered with the member functions \p getter and \p setter,
+ * when \p key matches its class and value type.
+ */
+template<typename Getter, typename Setter>
+typed_property_invoker get_member_func_invoker(const Getter& getter, const Setter& setter, const type& key) noexcept
+{
+    using class_type = typename member_func_property_getter_thunk<Getter>::class_type;
+    using value_type = typename member_func_property_getter_thunk<Getter>::value_type;
+
+    typed_property_invoker result = get_member_func_invoker(getter, key);
+    if (!result.getter)
+        return result;
+
+    if constexpr (std::is_invocable<Setter, class_type&, const value_type&>::value)
+    {
+        using setter_thunk = member_func_property_setter_thunk<Setter, class_type, value_type>;
+        result.setter       = reinterpret_cast<typed_property_invoker::erased_func>(&setter_thunk::set);
+        result.setter_data  = &setter;
+    }
+
+    return result;
+}
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_TYPED_PROPERTY_INVOKER_H_
@@ -102,13 +102,22 @@ static void* rttr_cast_impl(void* ptr)
     return static_cast<void*>(static_cast<BaseType*>(static_cast<DerivedType*>(ptr)));
 }
 
+/*!
+ * Creates the \ref base_class_info for the base class \p BaseType of \p DerivedType.
+ */
+template<typename DerivedType, typename BaseType>
+static base_class_info make_base_class_info()
+{
+    return base_class_info(type::get<BaseType>(), &rttr_cast_impl<DerivedType, BaseType>);
+}
+
 template<typename DerivedClass, typename BaseClass, typename... U>
 struct RTTR_LOCAL type_from_base_classes<DerivedClass, BaseClass, U...>
 {
     static inline void fill(info_container& vec)
     {
         static_assert(has_base_class_list<BaseClass>::value, "The parent class has no base class list defined - please use the macro RTTR_ENABLE");
-        vec.emplace_back(type::get<BaseClass>(), &rttr_cast_impl<DerivedClass, BaseClass>);
+        vec.push_back(make_base_class_info<DerivedClass, BaseClass>());
         // retrieve also the types of all base classes of the base classes; you will get an compile error here,
         // when the base class has not defined the 'base_class_list' typedef
         type_from_base_classes<DerivedClass, typename BaseClass::base_class_list>::fill(vec);
@@ -0,0 +1,150 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_CLASS_DATA_IMPL_H_
+#define RTTR_CLASS_DATA_IMPL_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/misc/flat_map.h"
+#include "rttr/detail/misc/perfect_hash_map.h"
+#include "rttr/detail/method/method_resolution_cache.h"
+#include "rttr/property.h"
+#include "rttr/method.h"
+#include "rttr/constructor.h"
+#include "rttr/string_view.h"
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace rttr
+{
+namespace detail
+{
+
+/*!
+ * The name indices of one class, which are created when the registry is frozen
+ * (see `type_register_private::freeze`); they are never modified afterwards.
+ */
+struct RTTR_LOCAL frozen_class_index
+{
+    perfect_hash_map<string_view, property> m_properties;
+    perfect_hash_map<string_view, method>   m_methods;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The members of a class, which match a certain \ref filter_items combination.
+ *
+ * A list is created on its first request and published with one atomic store,
+ * so afterwards a filtered range is returned without any allocation or predicate call.
+ * The lists are released, when the member list of the class is modified.
+ */
+template<typename T>
+class filtered_member_cache
+{
+    public:
+        //! The number of different \ref filter_items combinations
+        static constexpr std::size_t filter_count = 32;
+
+        filtered_member_cache() = default;
+        filtered_member_cache(const filtered_member_cache&) = delete;
+        filtered_member_cache& operator=(const filtered_member_cache&) = delete;
+
+        ~filtered_member_cache()
+        {
+            clear();
+        }
+
+        //! Returns the list of filter \p filter_index, or `nullptr` when it was not created yet.
+        const std::vector<T>* find(std::size_t filter_index) const noexcept
+        {
+            return m_lists[filter_index].load(std::memory_order_acquire);
+        }
+
+        /*!
+         * Publishes \p list as list of filter \p filter_index; when another thread was faster,
+         * its list is returned instead.
+         */
+        const std::vector<T>* insert(std::size_t filter_index, std::unique_ptr<std::vector<T>> list) noexcept
+        {
+            const std::vector<T>* expected = nullptr;
+            if (m_lists[filter_index].compare_exchange_strong(expected, list.get(), std::memory_order_acq_rel))
+                return list.release();
+
+            return expected;
+        }
+
+        //! Releases all lists; has to be called, when no range of a list is used anymore.
+        void clear() noexcept
+        {
+            for (auto& list : m_lists)
+                delete list.exchange(nullptr, std::memory_order_acq_rel);
+        }
+
+    private:
+        std::array<std::atomic<const std::vector<T>*>, filter_count> m_lists{};
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Private implementation of \ref class_data.
+ *
+ * The member lists contain the items of the class itself and all its base classes,
+ * ordered from base to derived. The name indices are rebuilt together with these lists
+ * (see `type_register_private::update_class_list`) and contain for every name
+ * the most-derived item, so a lookup by name does not have to scan the whole list.
+ * The result of an overload resolution by name and argument types is memoized
+ * in the method resolution cache, which is cleared whenever the method list changes.
+ * The members matching a \ref filter_items combination are cached the same way.
+ */
+struct RTTR_LOCAL class_data_impl
+{
+    std::vector<property>           m_properties;
+    std::vector<method>             m_methods;
+    std::vector<constructor>        m_ctors;
+
+    flat_map<string_view, property> m_property_index;
+    flat_map<string_view, method>   m_method_index;
+
+    method_resolution_cache         m_method_resolution_cache;
+
+    filtered_member_cache<property>     m_filtered_properties;
+    filtered_member_cache<method>       m_filtered_methods;
+    filtered_member_cache<constructor>  m_filtered_ctors;
+
+    //! Set while the registry is frozen; then it is used instead of the name indices above
+    std::atomic<const frozen_class_index*> m_frozen_index{nullptr};
+};
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_CLASS_DATA_IMPL_H_
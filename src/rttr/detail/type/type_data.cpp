@@ -27,23 +27,13 @@
 
 #include "rttr/type.h"
 #include "rttr/detail/type/type_data.h"
-#include "rttr/property.h"
-#include "rttr/method.h"
-#include "rttr/constructor.h"
+#include "rttr/detail/type/class_data_impl.h"
 
 namespace rttr
 {
 namespace detail
 {
 
-// Private implementation for class_data using PIMPL pattern
-struct class_data_impl
-{
-    std::vector<property>       m_properties;
-    std::vector<method>         m_methods;
-    std::vector<constructor>    m_ctors;
-};
-
 /////////////////////////////////////////////////////////////////////////////////////////
 
 static type_data& get_invalid_type_data_impl() noexcept
@@ -59,6 +49,7 @@ static type_data& get_invalid_type_data_impl() noexcept
                                get_create_wrapper_func<void>(),
                                nullptr,
                                false,
+                               invalid_basic_type_index,
                                type_trait_value{0},
                                class_data(nullptr, std::vector<type>())
                               };
@@ -83,6 +74,7 @@ type_data* get_invalid_type_data() noexcept
 class_data::class_data(get_derived_info_func func, std::vector<type> nested_types)
     : m_derived_info_func(func),
       m_nested_types(nested_types),
+      m_hierarchy_index(invalid_hierarchy_index),
       m_dtor(create_invalid_item<destructor>()),
       m_impl(std::make_unique<class_data_impl>())
 {
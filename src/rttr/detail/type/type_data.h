@@ -39,6 +39,8 @@
 #include "rttr/detail/misc/utility.h"
 #include "rttr/destructor.h"
 #include "rttr/detail/metadata/metadata.h"
+#include "rttr/detail/metadata/metadata_index.h"
+#include "rttr/detail/conversion/basic_type_index.h"
 
 // Forward declarations instead of full includes for Pimpl
 namespace rttr {
@@ -48,7 +50,9 @@ namespace rttr {
 }
 
 #include <type_traits>
+#include <atomic>
 #include <bitset>
+#include <cstdint>
 #include <memory>
 
 
@@ -82,6 +86,9 @@ enum class class_member_type
     constructors
 };
 
+//! The \ref class_data::m_hierarchy_index of a class, which is not a base class of any registered class.
+static constexpr std::size_t invalid_hierarchy_index = static_cast<std::size_t>(-1);
+
 struct RTTR_API class_data
 {
     class_data(get_derived_info_func func, std::vector<type> nested_types);
@@ -98,6 +105,10 @@ struct RTTR_API class_data
     std::vector<type>           m_derived_types;
     std::vector<rttr_cast_func> m_conversion_list;
     std::vector<type>           m_nested_types;
+    //! Dense index of this class among all base classes; its bit in \ref m_base_type_mask of every derived class is set
+    std::size_t                 m_hierarchy_index;
+    //! One bit per \ref m_hierarchy_index of the classes in \ref m_base_types
+    std::vector<std::uint64_t>  m_base_type_mask;
     destructor                  m_dtor;
     
     // Use pimpl pattern for C++20 compatibility with incomplete types
@@ -145,6 +156,8 @@ using visit_type_func      = void(*)(type_of_visit, visitor&, const type&);
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+struct type_lookup_table;
+
 struct RTTR_LOCAL type_data
 {
     type_data* raw_type_data;
@@ -167,12 +180,20 @@ struct RTTR_LOCAL type_data
     impl::visit_type_func      visit_type;
 
     bool is_valid;
+    //! The position inside \ref basic_type_list, used to dispatch the conversion of basic types
+    std::size_t basic_type_index;
     inline bool type_trait_value(type_trait_infos type_trait) const noexcept { return m_type_traits.test(static_cast<std::size_t>(type_trait)); }
 
 
     type_traits m_type_traits;
     class_data  m_class_data;
 
+    //! The registered converters and comparators of this type, see \ref type_register_private
+    std::atomic<const type_lookup_table*> m_lookup_table = nullptr;
+
+    //! The index of the metadata returned by \ref get_metadata, rebuild on every registration of metadata
+    std::vector<metadata_index::entry> m_metadata_index = {};
+
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -335,6 +356,7 @@ RTTR_LOCAL std::unique_ptr<type_data> make_type_data()
 
                             nullptr,
                             true,
+                            basic_type_index<T>::value,
                             type_trait_value{ TYPE_TRAIT_TO_BITSET_VALUE(is_class) |
                                               TYPE_TRAIT_TO_BITSET_VALUE(is_enum) |
                                               TYPE_TRAIT_TO_BITSET_VALUE(is_array) |
@@ -263,6 +263,13 @@ inline type create_type(type_data* data) noexcept
     return data ? type(data) : type();
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+inline std::size_t get_basic_type_index(const type& t) noexcept
+{
+    return t.m_type_data->basic_type_index;
+}
+
 /////////////////////////////////////////////////////////////////////////////////
 template<typename T>
 using is_complete_type = std::integral_constant<bool, !std::is_function<T>::value && !std::is_same<T, void>::value>;
@@ -380,6 +387,14 @@ inline bool type::is_base_of() const noexcept
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+template<typename T, typename Key>
+inline const T* type::get_metadata(const Key& key) const
+{
+    return detail::get_typed_metadata<T>(key, [this](const detail::metadata_key& k) { return get_metadata_value(k); });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 template<typename F>
 inline void type::register_converter_func(F func)
 {
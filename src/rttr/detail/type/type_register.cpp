@@ -41,6 +41,7 @@
 #include "rttr/property.h"
 #include "rttr/method.h"
 #include "rttr/detail/type/type_data.h"
+#include "rttr/detail/type/class_data_impl.h"
 
 #include "rttr/detail/filter/filter_item_funcs.h"
 #include "rttr/detail/type/type_string_utils.h"
@@ -55,14 +56,6 @@ namespace rttr
 namespace detail
 {
 
-// Private implementation for class_data using PIMPL pattern
-struct class_data_impl
-{
-    std::vector<property>       m_properties;
-    std::vector<method>         m_methods;
-    std::vector<constructor>    m_ctors;
-};
-
 /////////////////////////////////////////////////////////////////////////////////////////
 
 void type_register::register_reg_manager(registration_manager* manager)
@@ -138,6 +131,9 @@ bool type_register::register_destructor(destructor_wrapper_base* dtor)
 bool type_register::register_enumeration(enumeration_wrapper_base* enum_data)
 {
     const auto t = enum_data->get_type();
+    if (type_register_private::get_instance().reject_when_frozen(t, "enumeration"))
+        return false;
+
     t.m_type_data->enum_wrapper = enum_data;
     return true;
 }
@@ -146,9 +142,7 @@ bool type_register::register_enumeration(enumeration_wrapper_base* enum_data)
 
 bool type_register::unregister_enumeration(enumeration_wrapper_base* enum_data)
 {
-    const auto t = enum_data->get_type();
-    t.m_type_data->enum_wrapper = nullptr; // FIXME: possible unsafe: m_type_data can be invalid
-    return true;
+    return type_register_private::get_instance().unregister_enumeration(enum_data);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -162,16 +156,28 @@ void type_register::custom_name(type& t, string_view custom_name)
 
 void type_register::metadata(const type& t, std::vector<::rttr::detail::metadata> data)
 {
+    if (type_register_private::get_instance().reject_when_frozen(t, "metadata"))
+        return;
+
     auto& vec_to_insert = t.m_type_data->get_metadata();
+    auto& index = t.m_type_data->m_metadata_index;
+    const auto old_size = vec_to_insert.size();
 
     // when we insert new items, we want to check first whether a item with same key exist => ignore this data
     for (auto& new_item : data)
     {
-        if (type_register_private::get_metadata(new_item,  vec_to_insert).is_valid() == false)
+        const variant key = new_item.get_key();
+        if (metadata_index::find(vec_to_insert.data(), index.data(), old_size, make_metadata_key(key)))
+            continue;
+
+        const auto is_same_key = [&key](const ::rttr::detail::metadata& item) { return (item.get_key() == key); };
+        if (std::none_of(vec_to_insert.cbegin() + old_size, vec_to_insert.cend(), is_same_key))
             vec_to_insert.emplace_back(std::move(new_item));
     }
 
-    std::sort(vec_to_insert.begin(), vec_to_insert.end(), metadata::order_by_key());
+    // the keys are hashed only once, here
+    index.resize(vec_to_insert.size());
+    metadata_index::build(vec_to_insert.data(), index.data(), index.size());
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -220,6 +226,9 @@ bool type_register::unregister_less_than_comparator(const type_comparator_base*
 
 void type_register::register_base_class(const type& derived_type, const base_class_info& base_info)
 {
+    if (type_register_private::get_instance().reject_when_frozen(derived_type, "base class"))
+        return;
+
     auto& class_data = derived_type.m_type_data->m_class_data;
     auto itr = std::find_if(class_data.m_base_types.begin(), class_data.m_base_types.end(),
     [base_info](const type& t)
@@ -230,46 +239,52 @@ void type_register::register_base_class(const type& derived_type, const base_cla
     if (itr != class_data.m_base_types.end()) // already registered as base class => quit
         return;
 
-    std::vector<std::pair<type, rttr_cast_func>> tmp_sort_vec;
-    using sorted_pair = decltype(tmp_sort_vec)::value_type;
     if (class_data.m_base_types.size() != class_data.m_conversion_list.size())
         return; // error!!!
 
-    int index = 0;
-    for (const auto& item : class_data.m_base_types)
+    std::vector<base_class_info> tmp_sort_vec;
+    for (std::size_t index = 0; index < class_data.m_base_types.size(); ++index)
     {
-        tmp_sort_vec.emplace_back(item, class_data.m_conversion_list[index]);
-        ++index;
+        tmp_sort_vec.emplace_back(class_data.m_base_types[index], class_data.m_conversion_list[index]);
     }
 
-    tmp_sort_vec.emplace_back(base_info.m_base_type, base_info.m_rttr_cast_func);
+    tmp_sort_vec.push_back(base_info);
     std::sort(tmp_sort_vec.begin(), tmp_sort_vec.end(),
-    [](const sorted_pair& left, const sorted_pair& right)
-    { return left.first.get_id() < right.first.get_id(); });
+    [](const base_class_info& left, const base_class_info& right)
+    { return left.m_base_type.get_id() < right.m_base_type.get_id(); });
 
     class_data.m_base_types.clear();
     class_data.m_conversion_list.clear();
 
-    std::transform(tmp_sort_vec.begin(),
-                   tmp_sort_vec.end(),
-                   std::back_inserter(class_data.m_base_types),
-                   [](const sorted_pair& item)-> type { return item.first; });
-
-    std::transform(tmp_sort_vec.begin(),
-                   tmp_sort_vec.end(),
-                   std::back_inserter(class_data.m_conversion_list),
-                   [](const sorted_pair& item)-> rttr_cast_func { return item.second; });
+    for (const auto& item : tmp_sort_vec)
+    {
+        class_data.m_base_types.push_back(item.m_base_type);
+        class_data.m_conversion_list.push_back(item.m_rttr_cast_func);
+    }
 
     auto r_type = base_info.m_base_type.get_raw_type();
     r_type.m_type_data->m_class_data.m_derived_types.push_back(type(derived_type.m_type_data));
+
+    type_register_private::get_instance().add_to_base_type_mask(derived_type.m_type_data, r_type);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 type_register_private::type_register_private()
-:   m_type_list({ type(get_invalid_type_data()) }),
-    m_type_data_storage({ get_invalid_type_data() })
+:   m_type_data_storage({ get_invalid_type_data() }),
+    m_hierarchy_index_count(0),
+    m_version(1),
+    m_snapshot_version(0),
+    m_stale_lookup_count(0),
+    m_type_list(nullptr),
+    m_frozen_registry(nullptr),
+    m_rejected_count(0),
+    m_rejection_callback(nullptr)
 {
+    auto type_list = detail::make_unique<type_list_buffer>(64);
+    type_list->m_items[0] = type(get_invalid_type_data());
+    type_list->m_size.store(1, std::memory_order_relaxed);
+    publish_type_list(std::move(type_list));
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -495,17 +510,18 @@ type_data* type_register_private::register_name_if_neccessary(type_data* info)
 {
     using namespace detail;
 
+    std::lock_guard<std::mutex> lock(m_mutex);
+
     auto ret = m_orig_name_to_id.find(info->type_name);
     if (ret != m_orig_name_to_id.end())
         return ret->m_type_data;
 
-    std::lock_guard<std::mutex> lock(m_mutex);
-
     m_orig_name_to_id.insert(std::make_pair(info->type_name, type(info)));
     info->name = derive_name(type(info));
     m_custom_name_to_id.insert(std::make_pair(info->name, type(info)));
 
-    m_type_list.emplace_back(type(info));
+    add_to_type_list(type(info));
+    invalidate_snapshot();
     return nullptr;
 }
 
@@ -545,12 +561,62 @@ void type_register_private::register_base_class_info(type_data* info)
 
             auto r_type = t.m_base_type.get_raw_type();
             r_type.m_type_data->m_class_data.m_derived_types.push_back(type(info));
+
+            add_to_base_type_mask(info, r_type);
         }
     }
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+void type_register_private::add_to_base_type_mask(type_data* derived_type, const type& base_type)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto& base_class_data = base_type.m_type_data->m_class_data;
+    if (base_class_data.m_hierarchy_index == invalid_hierarchy_index)
+    {
+        if (m_free_hierarchy_indices.empty())
+        {
+            base_class_data.m_hierarchy_index = m_hierarchy_index_count++;
+        }
+        else
+        {
+            base_class_data.m_hierarchy_index = m_free_hierarchy_indices.back();
+            m_free_hierarchy_indices.pop_back();
+        }
+    }
+
+    const auto index = base_class_data.m_hierarchy_index;
+    auto& mask = derived_type->m_class_data.m_base_type_mask;
+    if (mask.size() <= index / 64)
+        mask.resize(index / 64 + 1, 0);
+
+    mask[index / 64] |= (std::uint64_t(1) << (index % 64));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void type_register_private::remove_from_base_type_masks(type_data* base_type)
+{
+    auto& base_class_data = base_type->m_class_data;
+    const auto index = base_class_data.m_hierarchy_index;
+    if (index == invalid_hierarchy_index)
+        return;
+
+    for (auto& derived_t : base_class_data.m_derived_types)
+    {
+        auto& mask = derived_t.m_type_data->m_class_data.m_base_type_mask;
+        if (index / 64 < mask.size())
+            mask[index / 64] &= ~(std::uint64_t(1) << (index % 64));
+    }
+
+    base_class_data.m_hierarchy_index = invalid_hierarchy_index;
+    m_free_hierarchy_indices.push_back(index);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 type_data* type_register_private::register_type(type_data* info) noexcept
 {
     // this will register the base types
@@ -604,7 +670,15 @@ void type_register_private::remove_base_types_from_derived_classes(type& t, cons
     {
         auto& class_data = data.m_type_data->m_class_data;
         auto& base_types = class_data.m_base_types;
-        base_types.erase(std::remove_if(base_types.begin(), base_types.end(), [t](type base_t) { return base_t == t; }));
+        auto itr = std::find(base_types.begin(), base_types.end(), t);
+        if (itr == base_types.end())
+            continue;
+
+        // the conversion list is stored in parallel to the base types
+        const auto index = std::distance(base_types.begin(), itr);
+        base_types.erase(itr);
+        if (index < static_cast<std::ptrdiff_t>(class_data.m_conversion_list.size()))
+            class_data.m_conversion_list.erase(class_data.m_conversion_list.begin() + index);
     }
 }
 
@@ -631,12 +705,26 @@ void type_register_private::unregister_type(type_data* info) noexcept
     // it can be, that a duplicate type_data object will try to unregister itself
     if (found_type_data)
     {
+        // only a type, which is part of the frozen tables, invalidates them
+        if (const auto frozen = m_frozen_registry.load(std::memory_order_relaxed))
+        {
+            const auto t = frozen->m_type_index.find(info->name, generate_hash(info->name.data(), info->name.size()));
+            if (t && t->m_type_data == info)
+                release_frozen_registry();
+        }
+
         type obj_t(info);
-        remove_container_item(m_type_list, obj_t);
+        remove_from_type_list(obj_t);
         remove_derived_types_from_base_classes(obj_t, info->m_class_data.m_base_types);
+        remove_from_base_type_masks(info);
         remove_base_types_from_derived_classes(obj_t, info->m_class_data.m_derived_types);
+
+        // the derived classes may have cached a method of this type
+        for (auto& derived_t : info->m_class_data.m_derived_types)
+            derived_t.m_type_data->m_class_data.m_impl->m_method_resolution_cache.clear();
         m_orig_name_to_id.erase(info->type_name);
         m_custom_name_to_id.erase(info->name);
+        invalidate_snapshot();
     }
 }
 
@@ -690,6 +778,7 @@ void type_register_private::update_custom_name(std::string new_name, const type&
 
         type_name = std::move(new_name);
         m_custom_name_to_id.insert(std::make_pair(type_name, t));
+        invalidate_snapshot();
     }
 }
 
@@ -721,15 +810,34 @@ std::string type_register_private::derive_name(const type& t)
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+bool type_register_private::unregister_enumeration(const enumeration_wrapper_base* enum_data)
+{
+    const auto t = enum_data->get_type();
+    if (t.m_type_data->enum_wrapper != enum_data) // FIXME: possible unsafe: m_type_data can be invalid
+        return false;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    release_frozen_registry();
+    t.m_type_data->enum_wrapper = nullptr;
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 void type_register_private::register_custom_name(type& t, string_view custom_name)
 {
-    if (!t.is_valid())
+    if (!t.is_valid() || reject_when_frozen(t, custom_name))
         return;
 
     update_custom_name(custom_name.to_string(), t);
 
     // we have to make a copy of the list, because we also perform an insertion with 'update_custom_name'
-    auto tmp_type_list = m_custom_name_to_id.value_data();
+    auto tmp_type_list = [this]()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_custom_name_to_id.value_data();
+    }();
     for (auto& tt : tmp_type_list)
     {
         if (tt == t || tt.get_raw_type() == tt)
@@ -753,8 +861,12 @@ void type_register_private::register_custom_name(type& t, string_view custom_nam
 bool type_register_private::register_constructor(const constructor_wrapper_base* ctor)
 {
     const auto t = ctor->get_declaring_type();
+    if (reject_when_frozen(t, "constructor"))
+        return false;
+
     auto& class_data = t.m_type_data->m_class_data;
     class_data.m_impl->m_ctors.emplace_back(create_item<::rttr::constructor>(ctor));
+    class_data.m_impl->m_filtered_ctors.clear();
     return true;
 }
 
@@ -765,6 +877,9 @@ bool type_register_private::register_constructor(const constructor_wrapper_base*
 bool type_register_private::register_destructor(const destructor_wrapper_base* dtor)
 {
     const auto t = dtor->get_declaring_type();
+    if (reject_when_frozen(t, "destructor"))
+        return false;
+
     auto& class_data = t.m_type_data->m_class_data;
 
     auto& dtor_type = class_data.m_dtor;
@@ -785,6 +900,9 @@ bool type_register_private::register_property(const property_wrapper_base* prop)
     const auto t    = prop->get_declaring_type();
     const auto name = prop->get_name();
 
+    if (reject_when_frozen(t, name))
+        return false;
+
     auto& property_list = t.m_type_data->m_class_data.m_impl->m_properties;
 
     if (get_type_property(t, name))
@@ -803,6 +921,9 @@ bool type_register_private::register_global_property(const property_wrapper_base
     const auto t    = prop->get_declaring_type();
     const auto name = prop->get_name();
 
+    if (reject_when_frozen(t, name))
+        return false;
+
      if (t.get_global_property(name))
          return false;
 
@@ -820,6 +941,11 @@ bool type_register_private::unregister_global_property(const property_wrapper_ba
     auto result     = g_props.erase(prop->get_name());
 
     auto result2 = remove_container_item(get_global_properties(), create_item<rttr::property>(prop));
+    if (result || result2)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        release_frozen_registry();
+    }
     return result && result2;
 }
 
@@ -831,6 +957,9 @@ bool type_register_private::register_method(const method_wrapper_base* meth)
 {
     const auto t    = meth->get_declaring_type();
     const auto name = meth->get_name();
+
+    if (reject_when_frozen(t, name))
+        return false;
     auto m          = create_item<::rttr::method>(meth);
 
     if (get_type_method(t, name, convert_param_list(meth->get_parameter_infos())))
@@ -848,6 +977,9 @@ bool type_register_private::register_global_method(const method_wrapper_base* me
 {
     const auto t    = meth->get_declaring_type();
     const auto name = meth->get_name();
+
+    if (reject_when_frozen(t, name))
+        return false;
     auto m          = create_item<::rttr::method>(meth);
 
     if (t.get_global_method(name, convert_param_list(meth->get_parameter_infos())))
@@ -866,6 +998,11 @@ bool type_register_private::unregister_global_method(const method_wrapper_base*
     auto result     = g_meths.erase(meth->get_name());
 
     auto result2 = remove_container_item(get_global_methods(), create_item<rttr::method>(meth));
+    if (result || result2)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        release_frozen_registry();
+    }
     return result && result2;
 }
 
@@ -873,11 +1010,11 @@ bool type_register_private::unregister_global_method(const method_wrapper_base*
 
 property type_register_private::get_type_property(const type& t, string_view name)
 {
-    for (const auto& prop : get_items_for_type(t, t.m_type_data->m_class_data.m_impl->m_properties))
-    {
-        if (prop.get_name() == name)
-            return prop;
-    }
+    // an own property always hides the base class properties with the same name in the index
+    const auto& index = t.m_type_data->m_class_data.m_impl->m_property_index;
+    const auto itr = index.find(name);
+    if (itr != index.end() && itr->get_declaring_type() == t)
+        return *itr;
 
     return create_invalid_item<::rttr::property>();
 }
@@ -910,6 +1047,8 @@ struct class_data_accessor<property>
 {
     static std::vector<property>& get(class_data& data) { return data.m_impl->m_properties; }
     static const std::vector<property>& get(const class_data& data) { return data.m_impl->m_properties; }
+    static flat_map<string_view, property>& get_index(class_data& data) { return data.m_impl->m_property_index; }
+    static filtered_member_cache<property>& get_filter_cache(class_data& data) { return data.m_impl->m_filtered_properties; }
 };
 
 template<>
@@ -917,6 +1056,8 @@ struct class_data_accessor<method>
 {
     static std::vector<method>& get(class_data& data) { return data.m_impl->m_methods; }
     static const std::vector<method>& get(const class_data& data) { return data.m_impl->m_methods; }
+    static flat_map<string_view, method>& get_index(class_data& data) { return data.m_impl->m_method_index; }
+    static filtered_member_cache<method>& get_filter_cache(class_data& data) { return data.m_impl->m_filtered_methods; }
 };
 
 template<>
@@ -951,6 +1092,19 @@ void type_register_private::update_class_list(const type& t)
     all_class_items.reserve(all_class_items.size() + item_vec.size());
     all_class_items.insert(all_class_items.end(), item_vec.begin(), item_vec.end());
 
+    // rebuild the name index; the items are ordered from base to derived,
+    // so we insert them in reverse order, because the first inserted name wins
+    std::vector<std::pair<string_view, ItemType>> index_items;
+    index_items.reserve(all_class_items.size());
+    for (auto itr = all_class_items.crbegin(); itr != all_class_items.crend(); ++itr)
+        index_items.emplace_back(itr->get_name(), *itr);
+
+    class_data_accessor<ItemType>::get_index(t.m_type_data->m_class_data).assign(index_items.cbegin(), index_items.cend());
+    class_data_accessor<ItemType>::get_filter_cache(t.m_type_data->m_class_data).clear();
+
+    if constexpr (std::is_same<ItemType, method>::value)
+        t.m_type_data->m_class_data.m_impl->m_method_resolution_cache.clear();
+
     // update derived types
     for (const auto& derived_type : t.get_derived_classes())
         update_class_list<ItemType>(derived_type);
@@ -960,68 +1114,117 @@ void type_register_private::update_class_list(const type& t)
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////
 
+std::unique_ptr<type_lookup_table> type_register_private::copy_lookup_table(const type& t) const
+{
+    const auto table = t.m_type_data->m_lookup_table.load(std::memory_order_relaxed);
+    return (table ? detail::make_unique<type_lookup_table>(*table) : detail::make_unique<type_lookup_table>());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void type_register_private::publish_lookup_table(const type& t, std::unique_ptr<type_lookup_table> table)
+{
+    t.m_type_data->m_lookup_table.store(table.get(), std::memory_order_release);
+    m_lookup_tables.push_back(std::move(table));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void type_register_private::reclaim_lookup_tables()
+{
+    std::vector<const type_lookup_table*> published_tables;
+    published_tables.reserve(m_type_data_storage.size());
+    for (const auto data : m_type_data_storage)
+    {
+        if (const auto table = data->m_lookup_table.load(std::memory_order_relaxed))
+            published_tables.push_back(table);
+    }
+    std::sort(published_tables.begin(), published_tables.end());
+
+    m_lookup_tables.erase(std::remove_if(m_lookup_tables.begin(), m_lookup_tables.end(),
+                                         [&published_tables](const std::unique_ptr<const type_lookup_table>& table)
+                                         {
+                                             return !std::binary_search(published_tables.cbegin(), published_tables.cend(),
+                                                                        table.get());
+                                         }),
+                          m_lookup_tables.end());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+const type_lookup_table* type_register_private::get_lookup_table(const type& t) noexcept
+{
+    return t.m_type_data->m_lookup_table.load(std::memory_order_acquire);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 bool type_register_private::register_converter(const type_converter_base* converter)
 {
     const auto t = converter->get_source_type();
+    if (reject_when_frozen(t, "converter"))
+        return false;
 
     if (!t.is_valid())
         return false;
 
+    std::lock_guard<std::mutex> lock(m_mutex);
+
     if (get_converter(t, converter->m_target_type))
         return false;
 
-    using vec_value_type = data_container<const type_converter_base*>;
-    m_type_converter_list.push_back({t.get_id(), converter});
-    std::stable_sort(m_type_converter_list.begin(), m_type_converter_list.end(),
-                     vec_value_type::order_by_id());
+    auto table = copy_lookup_table(t);
+    auto& converters = table->m_converters;
+    converters.insert(std::upper_bound(converters.begin(), converters.end(), converter->m_target_type.get_id(),
+                                       [](type::type_id id, const type_converter_base* item)
+                                       { return (id < item->m_target_type.get_id()); }),
+                      converter);
+    publish_lookup_table(t, std::move(table));
     return true;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-template<typename Container, typename Item>
-static bool remove_item(Container& container, Item& item)
+bool type_register_private::unregister_converter(const type_converter_base* converter)
 {
-    using order = typename Container::value_type::order_by_id;
-    auto itr = std::lower_bound(container.begin(), container.end(),
-                                item, order());
-    if (itr != container.end())
-    {
-        if ((*itr).m_data == item)
-        {
-            container.erase(itr);
-            return true;
-        }
-    }
-    return false;
-}
+    const auto t = converter->get_source_type();
 
-/////////////////////////////////////////////////////////////////////////////////////////
+    std::lock_guard<std::mutex> lock(m_mutex);
 
-bool type_register_private::unregister_converter(const type_converter_base* converter)
-{
-    return remove_item(m_type_converter_list, converter);
+    if (get_converter(t, converter->m_target_type) != converter)
+        return false;
+
+    release_frozen_registry();
+
+    auto table = copy_lookup_table(t);
+    auto& converters = table->m_converters;
+    converters.erase(std::remove(converters.begin(), converters.end(), converter), converters.end());
+    publish_lookup_table(t, std::move(table));
+    return true;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////
 
 const type_converter_base* type_register_private::get_converter(const type& source_type, const type& target_type)
 {
-    const auto src_id = source_type.get_id();
-    const auto target_id = target_type.get_id();
-    using vec_value_type = data_container<const type_converter_base*>;
-    auto itr = std::lower_bound(m_type_converter_list.cbegin(), m_type_converter_list.cend(),
-                                src_id, vec_value_type::order_by_id());
-    for (; itr != m_type_converter_list.cend(); ++itr)
+    if (const auto frozen = m_frozen_registry.load(std::memory_order_acquire))
     {
-        auto& item = *itr;
-        if (item.m_id != src_id)
-            break; // type not found
-
-        if (item.m_data->m_target_type.get_id() == target_id)
-            return item.m_data;
+        const auto converter = frozen->m_converter_index.find(std::make_pair(source_type, target_type),
+                                                              get_converter_hash(source_type, target_type));
+        return (converter ? *converter : nullptr);
     }
 
+    const auto table = get_lookup_table(source_type);
+    if (!table)
+        return nullptr;
+
+    const auto& converters = table->m_converters;
+    const auto itr = std::lower_bound(converters.cbegin(), converters.cend(), target_type.get_id(),
+                                      [](const type_converter_base* item, type::type_id id)
+                                      { return (item->m_target_type.get_id() < id); });
+    if (itr != converters.cend() && (*itr)->m_target_type == target_type)
+        return *itr;
+
     return nullptr;
 }
 
@@ -1029,129 +1232,419 @@ const type_converter_base* type_register_private::get_converter(const type& sour
 
 const type_comparator_base* type_register_private::get_equal_comparator(const type& t)
 {
-    return get_type_comparator_impl(t, m_type_equal_cmp_list);
+    const auto table = get_lookup_table(t);
+    return (table ? table->m_equal_comparator : nullptr);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////
 
 const type_comparator_base* type_register_private::get_less_than_comparator(const type& t)
 {
-    return get_type_comparator_impl(t, m_type_less_than_cmp_list);
+    const auto table = get_lookup_table(t);
+    return (table ? table->m_less_than_comparator : nullptr);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////
 
-const type_comparator_base*
-type_register_private::get_type_comparator_impl(const type& t,
-                                                const std::vector<type_register_private::data_container<const type_comparator_base*>>& comparator_list)
- {
-    using vec_value_type = data_container<const type_comparator_base*>;
-    const auto id = t.get_id();
-    auto itr = std::lower_bound(comparator_list.cbegin(), comparator_list.cend(), id,
-                                vec_value_type::order_by_id());
-    if (itr != comparator_list.cend() && itr->m_id == id)
-        return itr->m_data;
-    else
-        return nullptr;
- }
+bool type_register_private::register_equal_comparator(const type_comparator_base* comparator)
+{
+    const auto t = comparator->cmp_type;
+    if (reject_when_frozen(t, "equal comparator"))
+        return false;
+
+    if (!t.is_valid())
+        return false;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (get_equal_comparator(t)) // already registered an comparator ?
+        return false;
+
+    auto table = copy_lookup_table(t);
+    table->m_equal_comparator = comparator;
+    publish_lookup_table(t, std::move(table));
+    return true;
+}
 
 /////////////////////////////////////////////////////////////////////////////////////
 
-bool type_register_private::register_equal_comparator(const type_comparator_base* comparator)
+bool type_register_private::unregister_equal_comparator(const type_comparator_base* comparator)
 {
-    return register_comparator_impl(comparator->cmp_type, comparator, m_type_equal_cmp_list);
+    const auto t = comparator->cmp_type;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (get_equal_comparator(t) != comparator)
+        return false;
+
+    release_frozen_registry();
+
+    auto table = copy_lookup_table(t);
+    table->m_equal_comparator = nullptr;
+    publish_lookup_table(t, std::move(table));
+    return true;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////
 
-bool type_register_private::unregister_equal_comparator(const type_comparator_base* converter)
+bool type_register_private::register_less_than_comparator(const type_comparator_base* comparator)
 {
-    return remove_item(m_type_equal_cmp_list, converter);
+    const auto t = comparator->cmp_type;
+    if (reject_when_frozen(t, "less-than comparator"))
+        return false;
+
+    if (!t.is_valid())
+        return false;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (get_less_than_comparator(t)) // already registered an comparator ?
+        return false;
+
+    auto table = copy_lookup_table(t);
+    table->m_less_than_comparator = comparator;
+    publish_lookup_table(t, std::move(table));
+    return true;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////
 
-bool type_register_private::register_less_than_comparator(const type_comparator_base* comparator)
+bool type_register_private::unregister_less_than_comparator(const type_comparator_base* comparator)
 {
-    return register_comparator_impl(comparator->cmp_type, comparator, m_type_less_than_cmp_list);
+    const auto t = comparator->cmp_type;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (get_less_than_comparator(t) != comparator)
+        return false;
+
+    release_frozen_registry();
+
+    auto table = copy_lookup_table(t);
+    table->m_less_than_comparator = nullptr;
+    publish_lookup_table(t, std::move(table));
+    return true;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////
 
-bool type_register_private::unregister_less_than_comparator(const type_comparator_base* converter)
+const variant* type_register_private::get_metadata_value(const type& t, const metadata_key& key) noexcept
 {
-    return remove_item(m_type_less_than_cmp_list, converter);
+    const auto& meta_vec = t.m_type_data->get_metadata();
+    const auto& index = t.m_type_data->m_metadata_index;
+    return metadata_index::find(meta_vec.data(), index.data(), index.size(), key);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////
 
-bool type_register_private::register_comparator_impl(const type& t, const type_comparator_base* comparator,
-                                                     std::vector<data_container<const type_comparator_base*>>& comparator_list)
+std::vector<type_data*>& type_register_private::get_type_data_storage()
 {
-    if (!t.is_valid())
+    return m_type_data_storage;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+
+array_range<type> type_register_private::get_type_storage() const noexcept
+{
+    const auto type_list = m_type_list.load(std::memory_order_acquire);
+    const auto size = type_list->m_size.load(std::memory_order_acquire);
+    return array_range<type>(type_list->m_items.data() + 1, size - 1);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+
+void type_register_private::add_to_type_list(const type& t)
+{
+    auto type_list = m_type_list.load(std::memory_order_relaxed);
+    const auto size = type_list->m_size.load(std::memory_order_relaxed);
+    if (size == type_list->m_items.size())
+    {
+        auto new_list = detail::make_unique<type_list_buffer>(size * 2);
+        std::copy(type_list->m_items.cbegin(), type_list->m_items.cend(), new_list->m_items.begin());
+        new_list->m_size.store(size, std::memory_order_relaxed);
+        type_list = new_list.get();
+        publish_type_list(std::move(new_list));
+    }
+
+    // the item is not visible, until the new size is published
+    type_list->m_items[size] = t;
+    type_list->m_size.store(size + 1, std::memory_order_release);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+
+void type_register_private::remove_from_type_list(const type& t)
+{
+    const auto type_list = m_type_list.load(std::memory_order_relaxed);
+    const auto size = type_list->m_size.load(std::memory_order_relaxed);
+    const auto begin = type_list->m_items.cbegin();
+    if (std::find(begin, begin + size, t) == begin + size)
+        return;
+
+    // the published items are never modified, so the remaining types are copied into a new list
+    auto new_list = detail::make_unique<type_list_buffer>(type_list->m_items.size());
+    const auto new_end = std::remove_copy(begin, begin + size, new_list->m_items.begin(), t);
+    new_list->m_size.store(static_cast<std::size_t>(new_end - new_list->m_items.begin()), std::memory_order_relaxed);
+    publish_type_list(std::move(new_list));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+
+void type_register_private::publish_type_list(std::unique_ptr<type_list_buffer> list)
+{
+    m_type_list.store(list.get(), std::memory_order_release);
+    m_type_list_storage.push_back(std::move(list));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+
+flat_map<string_view, type>& type_register_private::get_orig_name_to_id()
+{
+    return m_orig_name_to_id;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+
+type type_register_private::get_by_name(string_view name, std::size_t hash_value)
+{
+    if (const auto frozen = m_frozen_registry.load(std::memory_order_acquire))
+    {
+        if (const auto t = frozen->m_type_index.find(name, hash_value))
+            return *t;
+
+        // the type might have been registered implicitly after the registry was frozen
+    }
+
+    const auto find_type = [name, hash_value](const name_snapshot& custom_name_to_id)
+    {
+        const auto ret = custom_name_to_id.find(name, hash_value);
+        return (ret != custom_name_to_id.end() ? *ret : get_invalid_type());
+    };
+
+    struct snapshot_cache
+    {
+        const type_register_private*                m_owner = nullptr;
+        std::uint64_t                               m_version = 0;
+        std::shared_ptr<const name_snapshot>        m_snapshot;
+    };
+    static thread_local snapshot_cache cache;
+
+    // fast path: no name was modified since this thread has seen the registry the last time
+    if (cache.m_owner == this && cache.m_version == m_version.load(std::memory_order_acquire))
+        return find_type(*cache.m_snapshot);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    const auto version = m_version.load(std::memory_order_relaxed);
+    if (!m_snapshot || m_snapshot_version != version)
+    {
+        // While types are still registered, the map is searched under the lock;
+        // it is only copied, when enough lookups were done since its last modification to pay for the copy.
+        // So registering types in between lookups does not copy the whole map every time.
+        if (++m_stale_lookup_count < m_custom_name_to_id.value_data().size() / 8)
+            return find_type(m_custom_name_to_id);
+
+        m_snapshot = std::make_shared<const name_snapshot>(m_custom_name_to_id);
+        m_snapshot_version = version;
+    }
+
+    // the old snapshot of this thread is released here; other threads keep their own reference
+    cache.m_owner       = this;
+    cache.m_version     = m_snapshot_version;
+    cache.m_snapshot    = m_snapshot;
+
+    return find_type(*cache.m_snapshot);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+
+void type_register_private::invalidate_snapshot()
+{
+    m_stale_lookup_count = 0;
+    m_version.fetch_add(1, std::memory_order_release);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t type_register_private::get_converter_hash(const type& source_type, const type& target_type) noexcept
+{
+    const auto source_hash = std::hash<type::type_id>()(source_type.get_id());
+    const auto target_hash = std::hash<type::type_id>()(target_type.get_id());
+    return (source_hash ^ (target_hash + static_cast<std::size_t>(0x9e3779b97f4a7c15) + (source_hash << 6) + (source_hash >> 2)));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+
+bool type_register_private::build_frozen_registry(frozen_registry& frozen) const
+{
+    // the names are copied into one buffer; it is reserved upfront, so the keys pointing into it stay valid
+    const auto& named_types = m_custom_name_to_id.value_data();
+    std::size_t name_buffer_size = 0;
+    for (const auto& t : named_types)
+        name_buffer_size += t.m_type_data->name.size();
+    frozen.m_name_buffer.reserve(name_buffer_size);
+
+    std::vector<perfect_hash_map<string_view, type>::item> type_items;
+    type_items.reserve(named_types.size());
+    for (const auto& t : named_types)
+    {
+        const auto& name = t.m_type_data->name;
+        const string_view key(frozen.m_name_buffer.data() + frozen.m_name_buffer.size(), name.size());
+        frozen.m_name_buffer.append(name);
+        type_items.push_back({key, generate_hash(name.data(), name.size()), t});
+    }
+
+    if (!frozen.m_type_index.build(std::move(type_items)))
         return false;
 
-    if (get_type_comparator_impl(t, comparator_list)) // already registered an comparator ?
+    std::vector<perfect_hash_map<std::pair<type, type>, const type_converter_base*>::item> converter_items;
+    for (const auto data : m_type_data_storage)
+    {
+        const auto& class_impl = *data->m_class_data.m_impl;
+        if (!class_impl.m_property_index.value_data().empty() || !class_impl.m_method_index.value_data().empty())
+            frozen.m_class_types.push_back(data);
+
+        const auto table = data->m_lookup_table.load(std::memory_order_relaxed);
+        if (!table)
+            continue;
+
+        const type source_type(data);
+        for (const auto converter : table->m_converters)
+        {
+            const auto& target_type = converter->m_target_type;
+            converter_items.push_back({std::make_pair(source_type, target_type),
+                                       get_converter_hash(source_type, target_type), converter});
+        }
+    }
+
+    if (!frozen.m_converter_index.build(std::move(converter_items)))
         return false;
 
-    using data_type = data_container<const type_comparator_base*>;
-    comparator_list.push_back({t.get_id(), comparator});
-    std::stable_sort(comparator_list.begin(), comparator_list.end(),
-                     data_type::order_by_id());
+    frozen.m_class_indices.resize(frozen.m_class_types.size());
+    for (std::size_t index = 0; index < frozen.m_class_types.size(); ++index)
+    {
+        const auto& class_impl = *frozen.m_class_types[index]->m_class_data.m_impl;
+        auto& class_index = frozen.m_class_indices[index];
+
+        std::vector<perfect_hash_map<string_view, property>::item> property_items;
+        for (const auto& prop : class_impl.m_property_index.value_data())
+        {
+            const auto name = prop.get_name();
+            property_items.push_back({name, generate_hash(name.data(), name.size()), prop});
+        }
+
+        std::vector<perfect_hash_map<string_view, method>::item> method_items;
+        for (const auto& meth : class_impl.m_method_index.value_data())
+        {
+            const auto name = meth.get_name();
+            method_items.push_back({name, generate_hash(name.data(), name.size()), meth});
+        }
+
+        if (!class_index.m_properties.build(std::move(property_items)) ||
+            !class_index.m_methods.build(std::move(method_items)))
+        {
+            return false;
+        }
+    }
+
     return true;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////
 
-variant type_register_private::get_metadata(const type& t, const variant& key)
+bool type_register_private::freeze()
 {
-    auto& meta_vec = t.m_type_data->get_metadata();
-    return get_metadata(key, meta_vec);
-}
+    std::lock_guard<std::mutex> lock(m_mutex);
 
-/////////////////////////////////////////////////////////////////////////////////////////
+    if (m_frozen_registry.load(std::memory_order_relaxed))
+        return true;
 
-variant type_register_private::get_metadata(const variant& key, const std::vector<metadata>& data)
-{
-    auto itr = std::lower_bound(data.cbegin(), data.cend(), key, metadata::order_by_key());
-    while (itr != data.cend())
+    auto frozen = detail::make_unique<frozen_registry>();
+    if (!build_frozen_registry(*frozen))
+        return false;
+
+    // nothing will be added anymore, so the lists can be compacted
+    m_type_data_storage.shrink_to_fit();
+    for (const auto data : m_type_data_storage)
     {
-        auto& item = *itr;
-        if (item.get_key() == key)
-            return item.get_value();
+        auto& class_impl = *data->m_class_data.m_impl;
+        class_impl.m_properties.shrink_to_fit();
+        class_impl.m_methods.shrink_to_fit();
+        class_impl.m_ctors.shrink_to_fit();
+    }
 
-        ++itr;
+    for (std::size_t index = 0; index < frozen->m_class_types.size(); ++index)
+    {
+        auto& class_impl = *frozen->m_class_types[index]->m_class_data.m_impl;
+        class_impl.m_frozen_index.store(&frozen->m_class_indices[index], std::memory_order_release);
     }
 
-    return variant();
+    // the registries and lookup tables, which were released by an unregistration, are not read anymore
+    m_frozen_registry_list.clear();
+    reclaim_lookup_tables();
+    m_frozen_registry.store(frozen.get(), std::memory_order_release);
+    m_frozen_registry_list.push_back(std::move(frozen));
+    return true;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////
 
-std::vector<type_data*>& type_register_private::get_type_data_storage()
+void type_register_private::thaw() noexcept
 {
-    return m_type_data_storage;
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    release_frozen_registry();
+    m_frozen_registry_list.clear();
+    reclaim_lookup_tables();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////
 
-std::vector<type>& type_register_private::get_type_storage()
+void type_register_private::release_frozen_registry() noexcept
 {
-    return m_type_list;
+    const auto frozen = m_frozen_registry.exchange(nullptr, std::memory_order_acq_rel);
+    if (!frozen)
+        return;
+
+    for (const auto data : frozen->m_class_types)
+        data->m_class_data.m_impl->m_frozen_index.store(nullptr, std::memory_order_release);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////
 
-flat_map<string_view, type>& type_register_private::get_orig_name_to_id()
+bool type_register_private::is_frozen() const noexcept
 {
-    return m_orig_name_to_id;
+    return (m_frozen_registry.load(std::memory_order_acquire) != nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t type_register_private::get_rejected_count() const noexcept
+{
+    return m_rejected_count.load(std::memory_order_relaxed);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////
 
-flat_map<std::string, type, hash>& type_register_private::get_custom_name_to_id()
+void type_register_private::set_rejection_callback(rejection_callback callback) noexcept
 {
-    return m_custom_name_to_id;
+    m_rejection_callback.store(callback, std::memory_order_release);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+
+bool type_register_private::reject_when_frozen(const type& t, string_view item) noexcept
+{
+    if (!is_frozen())
+        return false;
+
+    m_rejected_count.fetch_add(1, std::memory_order_relaxed);
+    if (const auto callback = m_rejection_callback.load(std::memory_order_acquire))
+        callback(t, item);
+
+    return true;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////
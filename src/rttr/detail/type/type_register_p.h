@@ -31,12 +31,15 @@
 #include "rttr/detail/base/core_prerequisites.h"
 #include "rttr/detail/misc/flat_multimap.h"
 #include "rttr/detail/misc/flat_map.h"
+#include "rttr/detail/misc/perfect_hash_map.h"
 #include "rttr/enumeration.h"
 #include "rttr/variant.h"
 #include "rttr/detail/metadata/metadata.h"
 
 #include "rttr/string_view.h"
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -58,6 +61,24 @@ class method_wrapper_base;
 class enumeration_wrapper_base;
 
 struct type_data;
+struct frozen_class_index;
+
+//! The signature of the function, which is called for every rejected registration; see \ref registration::set_rejection_callback()
+using rejection_callback = void(*)(const type& t, string_view item);
+
+/*!
+ * The converters and comparators, which are registered for one type.
+ *
+ * A table is referenced by \ref type_data::m_lookup_table and is never modified after it was published,
+ * so the lookup of a converter or comparator is one atomic load without any locking.
+ */
+struct type_lookup_table
+{
+    //! The registered converters of the type, with distinct target types; sorted by the id of the target type
+    std::vector<const type_converter_base*> m_converters;
+    const type_comparator_base*             m_equal_comparator      = nullptr;
+    const type_comparator_base*             m_less_than_comparator  = nullptr;
+};
 
 /*!
  * This class contains all logic to register properties, methods etc.. for a specific type.
@@ -87,8 +108,16 @@ public:
     bool register_global_method(const method_wrapper_base* meth);
     bool unregister_global_method(const method_wrapper_base* meth);
 
+    bool unregister_enumeration(const enumeration_wrapper_base* enum_data);
+
     void register_custom_name(type& t, string_view custom_name);
 
+    /*!
+     * Sets the bit of \p base_type in the base class mask of \p derived_type;
+     * \p base_type gets a hierarchy index, when it has none yet.
+     */
+    void add_to_base_type_mask(type_data* derived_type, const type& base_type);
+
     /////////////////////////////////////////////////////////////////////////////////////
     flat_multimap<string_view, ::rttr::property>& get_global_property_storage();
     flat_multimap<string_view, ::rttr::method>& get_global_method_storage();
@@ -101,9 +130,16 @@ public:
     /////////////////////////////////////////////////////////////////////////////////////
 
     std::vector<type_data*>& get_type_data_storage();
-    std::vector<type>& get_type_storage();
     flat_map<string_view, type>& get_orig_name_to_id();
-    flat_map<std::string, type, hash>& get_custom_name_to_id();
+
+    /*!
+     * Returns all registered types, without the invalid type.
+     * The returned range stays valid, even when types are registered or unregistered afterwards.
+     */
+    array_range<type> get_type_storage() const noexcept;
+
+    //! Returns the type with the custom name \p name, whose hash value is \p hash_value.
+    type get_by_name(string_view name, std::size_t hash_value);
 
     /////////////////////////////////////////////////////////////////////////////////////
 
@@ -123,8 +159,40 @@ public:
     const type_comparator_base* get_less_than_comparator(const type& t);
 
     /////////////////////////////////////////////////////////////////////////////////////
-    static variant get_metadata(const type& t, const variant& key);
-    static variant get_metadata(const variant& key, const std::vector<metadata>& data);
+    static const variant* get_metadata_value(const type& t, const metadata_key& key) noexcept;
+    /////////////////////////////////////////////////////////////////////////////////////
+
+    /////////////////////////////////////////////////////////////////////////////////////
+
+    /*!
+     * \brief Creates the immutable lookup tables and rejects all further registrations,
+     *        see \ref registration::freeze().
+     */
+    bool freeze();
+
+    /*!
+     * \brief Releases the frozen lookup tables and destroys them, see \ref registration::thaw().
+     */
+    void thaw() noexcept;
+
+    bool is_frozen() const noexcept;
+    std::size_t get_rejected_count() const noexcept;
+    void set_rejection_callback(rejection_callback callback) noexcept;
+
+    /*!
+     * Returns true, when the registry is frozen, i.e. the registration of the item \p item of type \p t
+     * has to be rejected; the rejected registration is counted and reported to the rejection callback.
+     */
+    bool reject_when_frozen(const type& t, string_view item) noexcept;
+
+    /*!
+     * Releases the frozen lookup tables, because a registered item will be removed.
+     * The tables itself stay alive, because they might still be read by another thread.
+     *
+     * \remark The caller has to hold \ref m_mutex.
+     */
+    void release_frozen_registry() noexcept;
+
     /////////////////////////////////////////////////////////////////////////////////////
 
     static type_register_private& get_instance();
@@ -133,48 +201,84 @@ private:
     type_register_private();
     ~type_register_private();
 
-    template<typename T, typename Data_Type = conditional_t<std::is_pointer<T>::value, T, std::unique_ptr<T>>>
-    struct data_container
+    /*!
+     * The list of all registered types. The items are sized to the capacity of the list and never moved;
+     * a new type is written behind the published size, so readers of the list never see a modified item.
+     */
+    struct type_list_buffer
+    {
+        explicit type_list_buffer(std::size_t capacity) : m_items(capacity, get_invalid_type()), m_size(0) {}
+
+        std::vector<type>                                           m_items;
+        std::atomic<std::size_t>                                    m_size;
+    };
+
+    /*!
+     * Appends \p t to the published type list; when its capacity is exhausted, a list with twice
+     * the capacity is published instead. Has to be called with \ref m_mutex locked.
+     */
+    void add_to_type_list(const type& t);
+
+    /*!
+     * Publishes a copy of the type list without \p t. Has to be called with \ref m_mutex locked.
+     */
+    void remove_from_type_list(const type& t);
+
+    /*!
+     * Publishes \p list as type list; the previous list stays alive,
+     * because a range returned by \ref get_type_storage() might still point into it.
+     */
+    void publish_type_list(std::unique_ptr<type_list_buffer> list);
+
+    //! An immutable copy of \ref m_custom_name_to_id, which can be read without any locking.
+    using name_snapshot = flat_map<std::string, type, hash>;
+
+    /*!
+     * The lookup tables, which are created by \ref freeze(). Every table has a minimal perfect hash,
+     * so a name or converter is found with exactly one probe and without any locking.
+     */
+    struct frozen_registry
     {
-        data_container(type::type_id id) : m_id(id) {}
-        data_container(type::type_id id, Data_Type data) : m_id(id), m_data(std::move(data)) {}
-        data_container(data_container<T, Data_Type>&& other) : m_id(other.m_id), m_data(std::move(other.m_data)) {}
-        data_container<T, Data_Type>& operator = (data_container<T, Data_Type>&& other)
-        {
-            m_id = other.m_id;
-            m_data = std::move(other.m_data);
-            return *this;
-        }
-
-        struct order_by_id
-        {
-            inline bool operator () ( const data_container<T>& _left, const data_container<T>& _right )  const
-            {
-                return _left.m_id < _right.m_id;
-            }
-            inline bool operator () ( const type::type_id& _left, const data_container<T>& _right ) const
-            {
-                return _left < _right.m_id;
-            }
-            inline bool operator () ( const data_container<T>& _left, const type::type_id& _right ) const
-            {
-                return _left.m_id < _right;
-            }
-
-            inline bool operator () ( const data_container<T>& _left, const Data_Type& _right ) const
-            {
-                return _left.m_data < _right;
-            }
-        };
-
-        type::type_id   m_id;
-        Data_Type       m_data;
+        //! All custom type names, stored one after another; the keys of \ref m_type_index point into this buffer
+        std::string                                                         m_name_buffer;
+        perfect_hash_map<string_view, type>                                 m_type_index;
+        perfect_hash_map<std::pair<type, type>, const type_converter_base*> m_converter_index;
+        //! The classes with members; the class at position i uses the name index at position i in \ref m_class_indices
+        std::vector<type_data*>                                             m_class_types;
+        std::vector<frozen_class_index>                                     m_class_indices;
     };
 
-    static bool register_comparator_impl(const type& t, const type_comparator_base* comparator,
-                                         std::vector<data_container<const type_comparator_base*>>& comparator_list);
-    static const type_comparator_base* get_type_comparator_impl(const type& t,
-                                                                const std::vector<data_container<const type_comparator_base*>>& comparator_list);
+    bool build_frozen_registry(frozen_registry& frozen) const;
+
+    static std::size_t get_converter_hash(const type& source_type, const type& target_type) noexcept;
+
+    /*!
+     * Marks the published name snapshot as outdated; see \ref get_by_name().
+     * Has to be called with \ref m_mutex locked, after \ref m_custom_name_to_id was modified.
+     */
+    void invalidate_snapshot();
+
+    static const type_lookup_table* get_lookup_table(const type& t) noexcept;
+
+    /*!
+     * Returns a modifiable copy of the currently published lookup table of type \p t.
+     * Has to be called with \ref m_mutex locked.
+     */
+    std::unique_ptr<type_lookup_table> copy_lookup_table(const type& t) const;
+
+    /*!
+     * Publishes \p table as lookup table of type \p t; the previous table stays alive until the next call
+     * of \ref reclaim_lookup_tables(), because it might still be read by another thread.
+     * Has to be called with \ref m_mutex locked.
+     */
+    void publish_lookup_table(const type& t, std::unique_ptr<type_lookup_table> table);
+
+    /*!
+     * Destroys all lookup tables, which are not published anymore.
+     * Has to be called with \ref m_mutex locked, while no other thread reads the reflection data,
+     * i.e. from \ref freeze() or \ref thaw().
+     */
+    void reclaim_lookup_tables();
 
     static ::rttr::property get_type_property(const type& t, string_view name);
     static ::rttr::method get_type_method(const type& t, string_view name,
@@ -186,7 +290,13 @@ private:
     static std::string derive_name(const type& t);
     //! Returns true, when the name was already registered
     type_data* register_name_if_neccessary(type_data* info);
-    static void register_base_class_info(type_data* info);
+    void register_base_class_info(type_data* info);
+
+    /*!
+     * Clears the bit of \p base_type in the base class mask of all its derived classes and releases its hierarchy index.
+     * Has to be called with \ref m_mutex locked.
+     */
+    void remove_from_base_type_masks(type_data* base_type);
     /*!
      * \brief This will create the derived name of a template instance, with all the custom names of a template parameter.
      * e.g.: `std::reference_wrapper<class std::basic_string<char,struct std::char_traits<char>,class std::allocator<char> > >` =>
@@ -215,7 +325,6 @@ private:
 
     flat_map<std::string, type, hash>                           m_custom_name_to_id;
     flat_map<string_view, type>                                 m_orig_name_to_id;
-    std::vector<type>                                           m_type_list;
     std::vector<type_data*>                                     m_type_data_storage;
 
     flat_multimap<string_view, ::rttr::property>                m_global_property_stroage;
@@ -223,11 +332,28 @@ private:
     std::vector<::rttr::property>                               m_global_properties;
     std::vector<::rttr::method>                                 m_global_methods;
 
-    std::vector<data_container<const type_converter_base*>>     m_type_converter_list;
-    std::vector<data_container<const type_comparator_base*>>    m_type_equal_cmp_list;
-    std::vector<data_container<const type_comparator_base*>>    m_type_less_than_cmp_list;
+    std::vector<std::unique_ptr<const type_lookup_table>>       m_lookup_tables;
+
+    std::size_t                                                 m_hierarchy_index_count;
+    std::vector<std::size_t>                                    m_free_hierarchy_indices;
 
+    //! Guards all containers above; readers use the published \ref name_snapshot and type list instead
     std::mutex                                                  m_mutex;
+    std::atomic<std::uint64_t>                                  m_version;
+    std::uint64_t                                               m_snapshot_version;
+    std::shared_ptr<const name_snapshot>                        m_snapshot;
+    //! The number of lookups, which had to read \ref m_custom_name_to_id under the lock since its last modification
+    std::size_t                                                 m_stale_lookup_count;
+
+    std::atomic<type_list_buffer*>                              m_type_list;
+    //! The published type list and all lists, which were published before
+    std::vector<std::unique_ptr<type_list_buffer>>              m_type_list_storage;
+
+    std::atomic<const frozen_registry*>                         m_frozen_registry;
+    //! The frozen registry and all registries, which were released since the last call of \ref freeze() or \ref thaw()
+    std::vector<std::unique_ptr<const frozen_registry>>         m_frozen_registry_list;
+    std::atomic<std::size_t>                                    m_rejected_count;
+    std::atomic<rejection_callback>                             m_rejection_callback;
 };
 
 } // end namespace detail
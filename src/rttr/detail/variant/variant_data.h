@@ -44,10 +44,16 @@ using variant_basic_types = type_list<bool,
                                       long int, unsigned long int, long long int,
                                       unsigned long long int, float, double, void*>;
 
+static_assert(RTTR_VARIANT_BUFFER_SIZE >= max_sizeof_list<variant_basic_types>::value,
+              "RTTR_VARIANT_BUFFER_SIZE has to be big enough to store every basic type.");
+
 /*!
  * This is the data storage for the \ref variant class.
+ *
+ * Every type which fits into the buffer is placed inline, all other types are allocated on the heap.
+ * The size can be configured with the CMake option `RTTR_VARIANT_BUFFER_SIZE`.
  */
-using variant_data = std::aligned_storage<max_sizeof_list<variant_basic_types>::value,
+using variant_data = std::aligned_storage<RTTR_VARIANT_BUFFER_SIZE,
                                           max_alignof_list<variant_basic_types>::value>::type;
 
 /////////////////////////////////////////////////////////////////////////////////////////
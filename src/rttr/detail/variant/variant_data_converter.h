@@ -28,10 +28,13 @@
 #ifndef RTTR_VARIANT_DATA_CONVERTER_H_
 #define RTTR_VARIANT_DATA_CONVERTER_H_
 
+#include "rttr/detail/conversion/basic_type_index.h"
 #include "rttr/detail/conversion/std_conversion_functions.h"
 #include "rttr/detail/conversion/number_conversion.h"
 #include "rttr/detail/enumeration/enumeration_helper.h"
 
+#include <array>
+
 namespace rttr
 {
 class argument;
@@ -44,11 +47,35 @@ struct convert_from;
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+template<typename T, typename Type_Converter, typename Target_Type>
+static bool convert_to_basic_type(const T& value, argument& arg)
+{
+    return Type_Converter::to(value, arg.get_value<Target_Type>());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+using basic_conversion_func = bool (*)(const T&, argument&);
+
+/*!
+ * Returns for every type in \ref basic_type_list the function, which converts a value of type \p T to it.
+ */
+template<typename T, typename Type_Converter, typename... Target_Types>
+constexpr std::array<basic_conversion_func<T>, sizeof...(Target_Types)> make_basic_conversion_table(type_list<Target_Types...>) noexcept
+{
+    return {{ &convert_to_basic_type<T, Type_Converter, Target_Types>... }};
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 /*!
  * The default converter manager class.
  *
  * It will check at runtime the incoming argument type and will forward its value to the corresponding conversion function.
  * All basic fixed integer and floating-point (float, double) types are handled.
+ * The conversion function is looked up with the basic type index of the argument type
+ * in a table, which is created at compile time.
  *
  * \remark Custom types will not be handled here,
  *         therefore a converter function has to be registered explicitly. See \ref type::register_converter_func.
@@ -59,38 +86,17 @@ struct default_type_converter
 {
     static bool convert_to(const T& value, argument& arg)
     {
-        const type target_type = arg.get_type();
-        if (target_type == type::get<bool>())
-            return Type_Converter::to(value, arg.get_value<bool>());
-        else if (target_type == type::get<char>())
-            return Type_Converter::to(value, arg.get_value<char>());
-        else if (target_type == type::get<int8_t>())
-            return Type_Converter::to(value, arg.get_value<int8_t>());
-        else if (target_type == type::get<int16_t>())
-            return Type_Converter::to(value, arg.get_value<int16_t>());
-        else if (target_type == type::get<int32_t>())
-            return Type_Converter::to(value, arg.get_value<int32_t>());
-        else if (target_type == type::get<int64_t>())
-            return Type_Converter::to(value, arg.get_value<int64_t>());
-        else if (target_type == type::get<uint8_t>())
-            return Type_Converter::to(value, arg.get_value<uint8_t>());
-        else if (target_type == type::get<uint16_t>())
-            return Type_Converter::to(value, arg.get_value<uint16_t>());
-        else if (target_type == type::get<uint32_t>())
-            return Type_Converter::to(value, arg.get_value<uint32_t>());
-        else if (target_type == type::get<uint64_t>())
-            return Type_Converter::to(value, arg.get_value<uint64_t>());
-        else if (target_type == type::get<float>())
-            return Type_Converter::to(value, arg.get_value<float>());
-        else if (target_type == type::get<double>())
-            return Type_Converter::to(value, arg.get_value<double>());
-        else if (target_type == type::get<std::string>())
-            return Type_Converter::to(value, arg.get_value<std::string>());
+        const std::size_t target_index = get_basic_type_index(arg.get_type());
+        if (target_index != invalid_basic_type_index)
+            return conversion_table[target_index](value, arg);
         else if (is_variant_with_enum(arg))
             return Type_Converter::to_enum(value, arg);
         else
             return false;
     }
+
+    static constexpr std::array<basic_conversion_func<T>, basic_type_count> conversion_table =
+        make_basic_conversion_table<T, Type_Converter>(basic_type_list());
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -36,6 +36,7 @@
 #include "rttr/detail/variant/variant_data_converter.h"
 #include "rttr/detail/comparison/compare_equal.h"
 #include "rttr/detail/comparison/compare_less.h"
+#include "rttr/variant_allocator.h"
 
 #include <cstdint>
 #include <new>
@@ -405,7 +406,8 @@ struct variant_data_policy_small : variant_data_base_policy<T, variant_data_poli
 
     static inline void swap(T& value, variant_data& dest)
     {
-        new (&dest) T(value);
+        // the source is destroyed afterwards, so we can move from it
+        new (&dest) T(std::move_if_noexcept(value));
         destroy(value);
     }
 
@@ -422,6 +424,7 @@ struct variant_data_policy_small : variant_data_base_policy<T, variant_data_poli
  * This policy is used for custom types that size does NOT fit into variant_data.
  *
  * Then the type will be allocated on the heap and a pointer to the data is stored in variant_data.
+ * The memory is requested from the installed \ref variant_allocator.
  */
 template<typename T, typename Converter>
 struct variant_data_policy_big : variant_data_base_policy<T, variant_data_policy_big<T>, Converter>
@@ -433,12 +436,13 @@ struct variant_data_policy_big : variant_data_base_policy<T, variant_data_policy
 
     static inline void destroy(T& value)
     {
-        delete &value;
+        value.~T();
+        deallocate_variant_data(const_cast<void*>(static_cast<const void*>(&value)), sizeof(T), alignof(T));
     }
-RTTR_BEGIN_DISABLE_INIT_LIST_WARNING
+
     static inline void clone(const T& value, variant_data& dest)
     {
-        reinterpret_cast<T*&>(dest) = new T(value);
+        reinterpret_cast<T*&>(dest) = allocate(value);
     }
 
     static inline void swap(T& value, variant_data& dest)
@@ -449,7 +453,24 @@ RTTR_BEGIN_DISABLE_INIT_LIST_WARNING
     template<typename U>
     static inline void create(U&& value, variant_data& dest)
     {
-        reinterpret_cast<T*&>(dest) = new T(std::forward<U>(value));
+        reinterpret_cast<T*&>(dest) = allocate(std::forward<U>(value));
+    }
+
+private:
+RTTR_BEGIN_DISABLE_INIT_LIST_WARNING
+    template<typename U>
+    static inline T* allocate(U&& value)
+    {
+        void* ptr = allocate_variant_data(sizeof(T), alignof(T));
+        try
+        {
+            return new (ptr) T(std::forward<U>(value));
+        }
+        catch (...)
+        {
+            deallocate_variant_data(ptr, sizeof(T), alignof(T));
+            throw;
+        }
     }
 RTTR_END_DISABLE_INIT_LIST_WARNING
 };
@@ -575,23 +596,28 @@ struct variant_data_policy_arithmetic : variant_data_base_policy<T, variant_data
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+using variant_data_policy_string_base = conditional_t<can_place_in_variant<std::string>::value,
+                                                      variant_data_policy_small<std::string, default_type_converter<std::string>>,
+                                                      variant_data_policy_big<std::string, default_type_converter<std::string>>>;
+
 /*!
  * This policy will manage the type std::string.
  *
  * This type has build in converter for several other basic types, that why we have a specialization here for it.
+ * When the string object fits into \ref variant_data, it is placed inline, otherwise it is allocated on the heap.
  */
-struct RTTR_API variant_data_policy_string : variant_data_policy_big<std::string, default_type_converter<std::string>>
+struct RTTR_API variant_data_policy_string : variant_data_policy_string_base
 {
     template<typename U>
     static inline void create(U&& value, variant_data& dest)
     {
-        reinterpret_cast<std::string*&>(dest) = new std::string(std::forward<U>(value));
+        variant_data_policy_string_base::create(std::forward<U>(value), dest);
     }
 
     template<std::size_t N>
     static inline void create(const char (&value)[N], variant_data& dest)
     {
-        reinterpret_cast<std::string*&>(dest) = new std::string(value, N - 1);
+        variant_data_policy_string_base::create(std::string(value, N - 1), dest);
     }
 };
 
@@ -64,7 +64,9 @@ class RTTR_LOCAL variant_associative_view_private
             m_clear_func(associative_container_empty::clear),
             m_equal_range_func(associative_container_empty::equal_range),
             m_insert_func_key(associative_container_empty::insert_key),
-            m_insert_func_key_value(associative_container_empty::insert_key_value)
+            m_insert_func_key_value(associative_container_empty::insert_key_value),
+            m_reserve_func(associative_container_empty::reserve),
+            m_insert_range_func(associative_container_empty::insert_range)
         {
         }
 
@@ -91,7 +93,9 @@ class RTTR_LOCAL variant_associative_view_private
             m_clear_func(associative_container_mapper_wrapper<RawType, ConstType>::clear),
             m_equal_range_func(associative_container_mapper_wrapper<RawType, ConstType>::equal_range),
             m_insert_func_key(associative_container_mapper_wrapper<RawType, ConstType>::insert_key),
-            m_insert_func_key_value(associative_container_mapper_wrapper<RawType, ConstType>::insert_key_value)
+            m_insert_func_key_value(associative_container_mapper_wrapper<RawType, ConstType>::insert_key_value),
+            m_reserve_func(associative_container_mapper_wrapper<RawType, ConstType>::reserve),
+            m_insert_range_func(associative_container_mapper_wrapper<RawType, ConstType>::insert_range)
         {
         }
 
@@ -137,6 +141,12 @@ class RTTR_LOCAL variant_associative_view_private
             m_end_func(m_container, itr);
         }
 
+        //! Returns true, when \p other views the same container as this view.
+        inline bool is_same_container(const variant_associative_view_private& other) const noexcept
+        {
+            return (m_container != nullptr && m_container == other.m_container);
+        }
+
         inline bool is_empty() const noexcept
         {
             return m_get_is_empty_func(m_container);
@@ -204,6 +214,16 @@ class RTTR_LOCAL variant_associative_view_private
             return m_insert_func_key_value(m_container, key, value, itr);
         }
 
+        inline bool reserve(std::size_t size)
+        {
+            return m_reserve_func(m_container, size);
+        }
+
+        inline std::size_t insert_range(const void* keys, const void* values, std::size_t count)
+        {
+            return m_insert_range_func(m_container, keys, values, count);
+        }
+
     private:
         static bool equal_cmp_dummy_func(const iterator_data& lhs_itr, const iterator_data& rhs_itr) noexcept;
         using equality_func     = decltype(&equal_cmp_dummy_func); // workaround because of 'noexcept' can only appear on function declaration
@@ -224,6 +244,8 @@ class RTTR_LOCAL variant_associative_view_private
                                           detail::iterator_data& itr_begin, detail::iterator_data& itr_end);
         using insert_func_key   = bool(*)(void* container, argument& key, detail::iterator_data& itr);
         using insert_func_key_value = bool(*)(void* container, argument& key, argument& value, detail::iterator_data& itr);
+        using reserve_func      = bool(*)(void* container, std::size_t size);
+        using insert_range_func = std::size_t(*)(void* container, const void* keys, const void* values, std::size_t count);
 
         type                    m_type;
         type                    m_key_type;
@@ -245,6 +267,8 @@ class RTTR_LOCAL variant_associative_view_private
         equal_range_func        m_equal_range_func;
         insert_func_key         m_insert_func_key;
         insert_func_key_value   m_insert_func_key_value;
+        reserve_func            m_reserve_func;
+        insert_range_func       m_insert_range_func;
 };
 
 } // end namespace detail
@@ -50,6 +50,7 @@ class RTTR_LOCAL variant_sequential_view_private
             m_container(nullptr),
             m_get_is_empty_func(sequential_container_empty::is_empty),
             m_get_size_func(sequential_container_empty::get_size),
+            m_get_contiguous_data_func(sequential_container_empty::get_contiguous_data),
             m_set_size_func(sequential_container_empty::set_size),
             m_is_dynamic_func(sequential_container_empty::is_dynamic),
             m_get_rank_func(sequential_container_empty::get_rank),
@@ -64,6 +65,9 @@ class RTTR_LOCAL variant_sequential_view_private
             m_erase_func(sequential_container_empty::erase),
             m_clear_func(sequential_container_empty::clear),
             m_insert_func(sequential_container_empty::insert),
+            m_reserve_func(sequential_container_empty::reserve),
+            m_insert_range_func(sequential_container_empty::insert_range),
+            m_erase_range_func(sequential_container_empty::erase_range),
             m_set_value_func(sequential_container_empty::set_value),
             m_get_value_func(sequential_container_empty::get_value)
         {
@@ -76,6 +80,7 @@ class RTTR_LOCAL variant_sequential_view_private
             m_container(as_void_ptr(container)),
             m_get_is_empty_func(sequential_container_mapper_wrapper<RawType, ConstType>::is_empty),
             m_get_size_func(sequential_container_mapper_wrapper<RawType, ConstType>::get_size),
+            m_get_contiguous_data_func(sequential_container_mapper_wrapper<RawType, ConstType>::get_contiguous_data),
             m_set_size_func(sequential_container_mapper_wrapper<RawType, ConstType>::set_size),
             m_is_dynamic_func(sequential_container_mapper_wrapper<RawType, ConstType>::is_dynamic),
             m_get_rank_func(sequential_container_mapper_wrapper<RawType, ConstType>::get_rank),
@@ -90,6 +95,9 @@ class RTTR_LOCAL variant_sequential_view_private
             m_erase_func(sequential_container_mapper_wrapper<RawType, ConstType>::erase),
             m_clear_func(sequential_container_mapper_wrapper<RawType, ConstType>::clear),
             m_insert_func(sequential_container_mapper_wrapper<RawType, ConstType>::insert),
+            m_reserve_func(sequential_container_mapper_wrapper<RawType, ConstType>::reserve),
+            m_insert_range_func(sequential_container_mapper_wrapper<RawType, ConstType>::insert_range),
+            m_erase_range_func(sequential_container_mapper_wrapper<RawType, ConstType>::erase_range),
             m_set_value_func(sequential_container_mapper_wrapper<RawType, ConstType>::set_value),
             m_get_value_func(sequential_container_mapper_wrapper<RawType, ConstType>::get_value)
         {
@@ -162,6 +170,43 @@ class RTTR_LOCAL variant_sequential_view_private
             return m_set_size_func(m_container, size);
         }
 
+        inline sequential_contiguous_data get_contiguous_data() const noexcept
+        {
+            return m_get_contiguous_data_func(m_container);
+        }
+
+        /*!
+         * Returns true, when \p other views the same container as this view, a container stored inside
+         * the elements of this view or elements overlapping with the elements of this view.
+         * Then a modification of this container can move or release the elements of \p other.
+         */
+        inline bool shares_storage_with(const variant_sequential_view_private& other) const noexcept
+        {
+            if (!m_container || !other.m_container)
+                return false;
+
+            if (m_container == other.m_container)
+                return true;
+
+            const auto data = get_contiguous_data();
+            if (data.m_stride == 0)
+                return false;
+
+            const auto begin = static_cast<const char*>(data.m_data);
+            const auto end = begin + data.m_size * data.m_stride;
+            const auto other_container = static_cast<const char*>(other.m_container);
+            if (other_container >= begin && other_container < end)
+                return true;
+
+            const auto other_data = other.get_contiguous_data();
+            if (other_data.m_stride == 0)
+                return false;
+
+            const auto other_begin = static_cast<const char*>(other_data.m_data);
+            const auto other_end = other_begin + other_data.m_size * other_data.m_stride;
+            return (begin < other_end && other_begin < end);
+        }
+
         inline bool equal(const iterator_data& lhs_itr, const iterator_data& rhs_itr) const noexcept
         {
             return m_equal_func(lhs_itr, rhs_itr);
@@ -193,6 +238,21 @@ class RTTR_LOCAL variant_sequential_view_private
             m_insert_func(m_container, value, itr_pos, itr);
         }
 
+        inline bool reserve(std::size_t size) const
+        {
+            return m_reserve_func(m_container, size);
+        }
+
+        inline bool insert_range(const iterator_data& itr_pos, const void* data, std::size_t count, iterator_data& itr)
+        {
+            return m_insert_range_func(m_container, data, count, itr_pos, itr);
+        }
+
+        inline bool erase_range(const iterator_data& itr_first, const iterator_data& itr_last, iterator_data& itr)
+        {
+            return m_erase_range_func(m_container, itr_first, itr_last, itr);
+        }
+
         inline bool set_value(std::size_t index, argument& arg)
         {
             return m_set_value_func(m_container, index, arg);
@@ -210,6 +270,7 @@ class RTTR_LOCAL variant_sequential_view_private
         using get_is_empty_func = bool(*)(void* container);
         using get_size_func     = std::size_t(*)(void* container);
         using set_size_func     = bool(*)(void* container, std::size_t size);
+        using get_contiguous_data_func = sequential_contiguous_data(*)(void* container);
         using get_rank_func     = std::size_t(*)(void);
         using get_rank_type_func= type(*)(std::size_t index);
         using begin_func        = void(*)(void* container, iterator_data& itr);
@@ -222,6 +283,11 @@ class RTTR_LOCAL variant_sequential_view_private
         using is_dynamic_func   = bool(*)();
         using erase_func        = void(*)(void* container, const iterator_data& itr_pos, iterator_data& itr);
         using insert_func       = void(*)(void* container, argument& value, const detail::iterator_data& itr_pos, detail::iterator_data& itr);
+        using reserve_func      = bool(*)(void* container, std::size_t size);
+        using insert_range_func = bool(*)(void* container, const void* data, std::size_t count,
+                                          const detail::iterator_data& itr_pos, detail::iterator_data& itr);
+        using erase_range_func  = bool(*)(void* container, const detail::iterator_data& itr_first,
+                                          const detail::iterator_data& itr_last, detail::iterator_data& itr);
         using set_value_func    = bool(*)(void* container, std::size_t index, argument& arg);
         using get_value_func    = variant(*)(void* container, std::size_t index);
 
@@ -230,6 +296,7 @@ class RTTR_LOCAL variant_sequential_view_private
         void*                   m_container;
         get_is_empty_func       m_get_is_empty_func;
         get_size_func           m_get_size_func;
+        get_contiguous_data_func m_get_contiguous_data_func;
         set_size_func           m_set_size_func;
         is_dynamic_func         m_is_dynamic_func;
         get_rank_func           m_get_rank_func;
@@ -244,6 +311,9 @@ class RTTR_LOCAL variant_sequential_view_private
         erase_func              m_erase_func;
         clear_func              m_clear_func;
         insert_func             m_insert_func;
+        reserve_func            m_reserve_func;
+        insert_range_func       m_insert_range_func;
+        erase_range_func        m_erase_range_func;
         set_value_func          m_set_value_func;
         get_value_func          m_get_value_func;
 };
@@ -140,6 +140,13 @@ variant enumeration::name_to_value(string_view name) const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+variant enumeration::name_to_value(const name_key& key) const
+{
+    return m_wrapper->name_to_value(key);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 bool enumeration::operator==(const enumeration& other) const noexcept
 {
     return (m_wrapper == other.m_wrapper);
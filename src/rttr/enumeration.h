@@ -31,6 +31,7 @@
 #include "rttr/detail/base/core_prerequisites.h"
 #include "rttr/type.h"
 #include "rttr/string_view.h"
+#include "rttr/name_key.h"
 #include "rttr/detail/misc/class_item_mapper.h"
 
 #include <memory>
@@ -201,6 +202,16 @@ class RTTR_API enumeration
          */
         variant name_to_value(string_view name) const;
 
+        /*!
+         * \brief Returns the value of the enumeration with the name of the given \p key,
+         *        or an empty variant if the name is not defined.
+         *
+         * Same as \ref name_to_value(string_view), but the hash of the name is taken from the key.
+         *
+         * \return A variant object, containing the value for the name of \p key.
+         */
+        variant name_to_value(const name_key& key) const;
+
         /*!
          * \brief Returns true if this enumeration is the same like the \p other.
          *
@@ -134,6 +134,13 @@ variant method::get_metadata(const variant& key) const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+const variant* method::get_metadata_value(const detail::metadata_key& key) const noexcept
+{
+    return m_wrapper->get_metadata_value(key);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 variant method::invoke(instance object) const
 {
     return m_wrapper->invoke(object);
@@ -192,6 +199,13 @@ variant method::invoke_variadic(instance object, std::vector<argument> args) con
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+detail::typed_method_invoker method::get_typed_invoker(const type& signature) const noexcept
+{
+    return m_wrapper->get_typed_invoker(signature);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 bool method::operator==(const method& other) const noexcept
 {
     return (m_wrapper == other.m_wrapper);
@@ -48,9 +48,14 @@ class argument;
 class method;
 class visitor;
 
+template<typename Signature>
+class method_handle;
+
 namespace detail
 {
     class method_wrapper_base;
+    struct typed_method_invoker;
+    struct metadata_key;
 }
 
 /*!
@@ -203,6 +208,20 @@ class RTTR_API method
          */
         variant get_metadata(const variant& key) const;
 
+        /*!
+         * \brief Returns a pointer to the meta data value for the given key \p key, when the value is of type \p T.
+         *
+         * In contrast to \ref get_metadata(const variant&) const, the value is not copied into a \ref variant
+         * and for integral, enum and string keys also no \ref variant for the key is created.
+         *
+         * \remark When no meta data is registered with the given \p key, or its value is not of type \p T,
+         *         a `nullptr` is returned.
+         *
+         * \return A pointer to the meta data value.
+         */
+        template<typename T, typename Key>
+        const T* get_metadata(const Key& key) const;
+
         /*!
          * \brief Invokes the method represented by the current instance \p object.
          *
@@ -342,11 +361,17 @@ class RTTR_API method
 
         void visit(visitor& visitor) const noexcept;
 
+        detail::typed_method_invoker get_typed_invoker(const type& signature) const noexcept;
+
+        const variant* get_metadata_value(const detail::metadata_key& key) const noexcept;
+
         template<typename T>
         friend T detail::create_item(const detail::class_item_to_wrapper_t<T>* wrapper);
         template<typename T>
         friend T detail::create_invalid_item();
         friend class visitor;
+        template<typename Signature>
+        friend class method_handle;
 
     private:
         const detail::method_wrapper_base* m_wrapper;
@@ -354,4 +379,6 @@ class RTTR_API method
 
 } // end namespace rttr
 
+#include "rttr/detail/impl/method_impl.h"
+
 #endif // RTTR_METHOD_H_
@@ -0,0 +1,124 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_METHOD_HANDLE_H_
+#define RTTR_METHOD_HANDLE_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/method.h"
+
+namespace rttr
+{
+
+template<typename Signature>
+class method_handle;
+
+/*!
+ * The \ref method_handle class provides a typed call of a registered \ref method.
+ *
+ * The signature is verified once, when the handle is created. A call through the handle will then directly
+ * invoke the underlying function via one function pointer, without wrapping the arguments into \ref argument
+ * objects and without returning a \ref variant.
+ *
+ * The \p Signature has to match **exactly** the native signature of the registered function:
+ * - a free function or static method `R f(Args...)` uses `R(Args...)`
+ * - a member function `R C::f(Args...)` uses `R(C&, Args...)`
+ * - a const member function `R C::f(Args...) const` uses `R(const C&, Args...)` or `R(C&, Args...)`
+ *
+ * \remark Policies of the method are not applied (e.g. a reference is returned as reference) and
+ *         default arguments have to be provided explicitly.
+ *         The handle must not outlive the registration of the method.
+ *
+ * Copying and assigning a \ref method_handle object is very cheap. Internally only two pointers are copied.
+ *
+ * A typical example is the following:
+ *
+ * \code{.cpp}
+ *  struct MyStruct { int my_method(int param) { return param; } };
+ *  //...
+ *  method meth = type::get<MyStruct>().get_method("my_method");
+ *  method_handle<int(MyStruct&, int)> handle(meth);
+ *  if (handle)
+ *  {
+ *     MyStruct obj;
+ *     std::cout << handle(obj, 23); // prints 23
+ *  }
+ * \endcode
+ *
+ * \see method
+ */
+template<typename R, typename... Args>
+class method_handle<R(Args...)>
+{
+    public:
+        /*!
+         * \brief Creates an invalid handle.
+         */
+        method_handle() noexcept;
+
+        /*!
+         * \brief Creates a handle for the given method \p meth.
+         *
+         * When the signature of \p meth does not match `R(Args...)`, the handle is invalid.
+         */
+        explicit method_handle(const method& meth) noexcept;
+
+        /*!
+         * \brief Returns true if this handle can be invoked, otherwise false.
+         *
+         * \return True if this handle is valid, otherwise false.
+         */
+        bool is_valid() const noexcept;
+
+        /*!
+         * \brief Convenience function to check if this handle is valid or not.
+         *
+         * \return True if this handle is valid, otherwise false.
+         */
+        explicit operator bool() const noexcept;
+
+        /*!
+         * \brief Invokes the underlying function with the given arguments \p args.
+         *
+         * \remark Invoking an invalid handle is undefined behavior.
+         *
+         * \return The return value of the function.
+         */
+        R operator()(Args... args) const;
+
+    private:
+        using invoker_func = R(*)(const void*, Args...);
+
+        invoker_func    m_func;
+        const void*     m_data;
+};
+
+} // end namespace rttr
+
+#include "rttr/detail/impl/method_handle_impl.h"
+
+#endif // RTTR_METHOD_HANDLE_H_
@@ -0,0 +1,112 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_NAME_KEY_H_
+#define RTTR_NAME_KEY_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/string_view.h"
+
+#include <cstddef>
+
+namespace rttr
+{
+
+/*!
+ * The \ref name_key class holds a name together with its hash value.
+ *
+ * All lookups by name (e.g. \ref type::get_property(), \ref type::get_method(), \ref type::get_by_name() or
+ * \ref enumeration::name_to_value()) have to hash the given name first. A \ref name_key computes this hash only once:
+ * for a string literal at compile time and for a dynamic string when the key is created; the key can then be reused
+ * for any number of lookups.
+ *
+ * \remark The key does not copy the name, the referred characters have to outlive the key (like for a \ref string_view).
+ *
+ * A typical example is the following:
+ *
+ * \code{.cpp}
+ *  using namespace rttr::literals;
+ *
+ *  property prop = type::get<MyStruct>().get_property("value"_key); // hashed at compile time
+ *
+ *  static constexpr name_key method_key("my_method");
+ *  method meth = type::get<MyStruct>().get_method(method_key);
+ *
+ *  std::string name = read_name();
+ *  const name_key dynamic_key(name); // hashed once
+ *  for (auto& t : type_list)
+ *      t.get_property(dynamic_key);
+ * \endcode
+ */
+class name_key
+{
+    public:
+        /*!
+         * \brief Creates a key for the given name \p name; in a constant expression the hash is computed
+         *        at compile time.
+         */
+        explicit constexpr name_key(string_view name) noexcept;
+
+        /*!
+         * \brief Returns the name of this key.
+         *
+         * \return The name.
+         */
+        constexpr string_view get_name() const noexcept;
+
+        /*!
+         * \brief Returns the hash value of the name; the same value is used by all name indices of RTTR.
+         *
+         * \return The hash value.
+         */
+        constexpr std::size_t get_hash() const noexcept;
+
+    private:
+        string_view m_name;
+        std::size_t m_hash;
+};
+
+namespace literals
+{
+
+/*!
+ * \brief Creates a \ref name_key from the given string literal; the hash is always computed at compile time.
+ *
+ * \code{.cpp}
+ *  using namespace rttr::literals;
+ *  type::get_by_name("MyStruct"_key);
+ * \endcode
+ */
+consteval name_key operator""_key(const char* text, std::size_t length) noexcept;
+
+} // end namespace literals
+
+} // end namespace rttr
+
+#include "rttr/detail/impl/name_key_impl.h"
+
+#endif // RTTR_NAME_KEY_H_
@@ -156,6 +156,13 @@ variant property::get_metadata(const variant& key) const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+const variant* property::get_metadata_value(const detail::metadata_key& key) const noexcept
+{
+    return m_wrapper->get_metadata_value(key);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 bool property::operator==(const property& other) const noexcept
 {
     return (m_wrapper == other.m_wrapper);
@@ -177,4 +184,11 @@ void property::visit(visitor& visitor) const noexcept
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+detail::typed_property_invoker property::get_typed_accessor(const type& key) const noexcept
+{
+    return m_wrapper->get_typed_accessor(key);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 } // end namespace rttr
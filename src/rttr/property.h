@@ -46,9 +46,14 @@ class argument;
 class property;
 class visitor;
 
+template<typename Class_Type, typename T>
+class property_accessor;
+
 namespace detail
 {
     class property_wrapper_base;
+    struct typed_property_invoker;
+    struct metadata_key;
 }
 
 /*!
@@ -241,6 +246,20 @@ class RTTR_API property
          */
         variant get_metadata(const variant& key) const;
 
+        /*!
+         * \brief Returns a pointer to the meta data value for the given key \p key, when the value is of type \p T.
+         *
+         * In contrast to \ref get_metadata(const variant&) const, the value is not copied into a \ref variant
+         * and for integral, enum and string keys also no \ref variant for the key is created.
+         *
+         * \remark When no meta data is registered with the given \p key, or its value is not of type \p T,
+         *         a `nullptr` is returned.
+         *
+         * \return A pointer to the meta data value.
+         */
+        template<typename T, typename Key>
+        const T* get_metadata(const Key& key) const;
+
         /*!
          * \brief Returns true if this property is the same like the \p other.
          *
@@ -261,11 +280,17 @@ class RTTR_API property
 
         void visit(visitor& visitor) const noexcept;
 
+        detail::typed_property_invoker get_typed_accessor(const type& key) const noexcept;
+
+        const variant* get_metadata_value(const detail::metadata_key& key) const noexcept;
+
         template<typename T>
         friend T detail::create_item(const detail::class_item_to_wrapper_t<T>* wrapper);
         template<typename T>
         friend T detail::create_invalid_item();
         friend class visitor;
+        template<typename Class_Type, typename T>
+        friend class property_accessor;
 
     private:
         const detail::property_wrapper_base* m_wrapper;
@@ -273,4 +298,6 @@ class RTTR_API property
 
 } // end namespace rttr
 
+#include "rttr/detail/impl/property_impl.h"
+
 #endif // RTTR_PROPERTY_H_
@@ -0,0 +1,158 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_PROPERTY_ACCESSOR_H_
+#define RTTR_PROPERTY_ACCESSOR_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/property.h"
+
+namespace rttr
+{
+
+/*!
+ * The \ref property_accessor class provides typed access to a member \ref property of class \p Class_Type
+ * with the value type \p T.
+ *
+ * The class and value type are verified once, when the accessor is created. The access itself does not use
+ * \ref variant or \ref argument objects: a property registered as pointer to member object is read and
+ * written directly through the member pointer, a property registered with getter and setter member functions
+ * calls these functions through one function pointer.
+ *
+ * \p Class_Type has to be **exactly** the class, which declares the member and \p T the value type of the property
+ * without reference and cv-qualifiers; registration policies (e.g. \ref policy::prop::bind_as_ptr) are not applied.
+ *
+ * Copying and assigning a \ref property_accessor object is very cheap.
+ *
+ * A typical example is the following:
+ *
+ * \code{.cpp}
+ *  struct MyStruct { int value; };
+ *  //...
+ *  property prop = type::get<MyStruct>().get_property("value");
+ *  property_accessor<MyStruct, int> acc(prop);
+ *  MyStruct obj;
+ *  if (acc && !acc.is_readonly())
+ *  {
+ *     acc.set(obj, 23);
+ *     std::cout << acc.get(obj); // prints 23
+ *  }
+ * \endcode
+ *
+ * \remark The accessor must not outlive the registration of the property.
+ *
+ * \see property
+ */
+template<typename Class_Type, typename T>
+class property_accessor
+{
+    public:
+        /*!
+         * \brief Creates an invalid accessor.
+         */
+        property_accessor() noexcept;
+
+        /*!
+         * \brief Creates an accessor for the given property \p prop.
+         *
+         * When \p prop is not a member property of \p Class_Type with the value type \p T, the accessor is invalid.
+         */
+        explicit property_accessor(const property& prop) noexcept;
+
+        /*!
+         * \brief Returns true if the value of the property can be read with this accessor, otherwise false.
+         *
+         * \return True if this accessor is valid, otherwise false.
+         */
+        bool is_valid() const noexcept;
+
+        /*!
+         * \brief Convenience function to check if this accessor is valid or not.
+         *
+         * \return True if this accessor is valid, otherwise false.
+         */
+        explicit operator bool() const noexcept;
+
+        /*!
+         * \brief Returns true when the value cannot be set with this accessor.
+         *
+         * \return True if the accessor is read only, otherwise false.
+         */
+        bool is_readonly() const noexcept;
+
+        /*!
+         * \brief Returns true when a reference to the value can be returned via \ref get_ref(),
+         *        i.e. the property is registered as writeable pointer to member object.
+         *
+         * \return True if \ref get_ref() can be called, otherwise false.
+         */
+        bool has_ref() const noexcept;
+
+        /*!
+         * \brief Returns a copy of the property value of the given object \p obj.
+         *
+         * \remark Calling this function on an invalid accessor is undefined behavior.
+         */
+        T get(const Class_Type& obj) const;
+
+        /*!
+         * \brief Sets the property value of the given object \p obj to \p value.
+         *
+         * \return True if the value was set, otherwise false; e.g. when the accessor is read only or invalid.
+         */
+        bool set(Class_Type& obj, const T& value) const;
+
+        /*!
+         * \brief Returns a reference to the property value of the given object \p obj.
+         *
+         * \remark Calling this function, when \ref has_ref() returns false, is undefined behavior.
+         */
+        T& get_ref(Class_Type& obj) const noexcept;
+
+        /*!
+         * \brief Returns a const reference to the property value of the given object \p obj.
+         *
+         * \remark Calling this function, when \ref has_ref() returns false, is undefined behavior.
+         */
+        const T& get_ref(const Class_Type& obj) const noexcept;
+
+    private:
+        using getter_func = T(*)(const void*, const Class_Type&);
+        using setter_func = void(*)(const void*, Class_Type&, const T&);
+
+        T Class_Type::* m_member;
+        getter_func     m_getter;
+        const void*     m_getter_data;
+        setter_func     m_setter;
+        const void*     m_setter_data;
+};
+
+} // end namespace rttr
+
+#include "rttr/detail/impl/property_accessor_impl.h"
+
+#endif // RTTR_PROPERTY_ACCESSOR_H_
@@ -26,6 +26,7 @@
 *************************************************************************************/
 
 #include "rttr/registration.h"
+#include "rttr/detail/type/type_register_p.h"
 
 namespace rttr
 {
@@ -36,4 +37,39 @@ const detail::protected_access registration::protected_access = {};
 
 const detail::private_access registration::private_access = {};
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool registration::freeze()
+{
+    return detail::type_register_private::get_instance().freeze();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void registration::thaw() noexcept
+{
+    detail::type_register_private::get_instance().thaw();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool registration::is_frozen() noexcept
+{
+    return detail::type_register_private::get_instance().is_frozen();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t registration::get_rejected_count() noexcept
+{
+    return detail::type_register_private::get_instance().get_rejected_count();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void registration::set_rejection_callback(rejection_callback callback) noexcept
+{
+    detail::type_register_private::get_instance().set_rejection_callback(callback);
+}
+
 } // end namespace rttr
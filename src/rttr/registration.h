@@ -356,6 +356,58 @@ public:
     template<typename Enum_Type>
     static bind<detail::enum_, detail::invalid_type, Enum_Type> enumeration(string_view name);
 
+    /*!
+     * \brief Freezes the registry: the names of all types, the member names of all classes and all converters
+     *        are compacted into immutable tables with a minimal perfect hash.
+     *
+     * Afterwards a lookup by name (\ref type::get_by_name(), \ref type::get_property(), \ref type::get_method())
+     * and the lookup of a converter need exactly one probe and take no lock.
+     * Every further registration of an item (property, method, converter, custom name...) is rejected
+     * and counted, see \ref get_rejected_count() and \ref set_rejection_callback();
+     * a type itself is still registered implicitly via \ref type::get<T>().
+     * Unloading a \ref library, which removes an item of the frozen registry, thaws the registry again;
+     * a library, which was loaded after the freeze, can be unloaded without thawing it.
+     *
+     * \remark Call this function at the end of the startup, while no other thread uses the reflection data;
+     *         a range of class members (e.g. from \ref type::get_properties()), retrieved before, becomes invalid.
+     *
+     * \return `true`, when the registry is frozen; otherwise `false`, e.g. when two names have the same hash value.
+     */
+    static bool freeze();
+
+    /*!
+     * \brief Thaws the registry, i.e. the lookup tables created by \ref freeze() are destroyed
+     *        and new registrations are accepted again.
+     *
+     * \remark Call this function only while no other thread uses the reflection data.
+     */
+    static void thaw() noexcept;
+
+    /*!
+     * \brief Returns `true`, when the registry is frozen, see \ref freeze().
+     */
+    static bool is_frozen() noexcept;
+
+    /*!
+     * \brief Returns the number of registrations, which were rejected because the registry was frozen.
+     */
+    static std::size_t get_rejected_count() noexcept;
+
+    /*!
+     * The signature of the function, which is called for a rejected registration:
+     * \p t is the type, which declares the item, and \p item is the name of the item (e.g. of a property),
+     * or its kind (e.g. `"converter"`).
+     */
+    using rejection_callback = void(*)(const type& t, string_view item);
+
+    /*!
+     * \brief Sets the function \p callback, which is called for every registration,
+     *        which is rejected because the registry is frozen; e.g. in order to log it or to trigger an assertion.
+     *
+     * The callback must not throw; with `nullptr` the rejected registrations are only counted.
+     */
+    static void set_rejection_callback(rejection_callback callback) noexcept;
+
     /////////////////////////////////////////////////////////////////////////////////////
 
     /*!
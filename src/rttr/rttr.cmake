@@ -37,8 +37,11 @@ set(HEADER_FILES access_levels.h
                  instance.h
                  library.h
                  method.h
+                 method_handle.h
+                 name_key.h
                  policy.h
                  property.h
+                 property_accessor.h
                  parameter_info.h
                  registration
                  registration_friend
@@ -52,6 +55,7 @@ set(HEADER_FILES access_levels.h
                  type.h
                  type_list.h
                  variant.h
+                 variant_allocator.h
                  variant_associative_view.h
                  variant_sequential_view.h
                  visitor.h
@@ -72,13 +76,16 @@ set(HEADER_FILES access_levels.h
                  detail/constructor/constructor_wrapper.h
                  detail/constructor/constructor_wrapper_defaults.h
                  detail/constructor/constructor_wrapper_base.h
+                 detail/conversion/basic_type_index.h
                  detail/conversion/std_conversion_functions.h
+                 detail/conversion/number_array_conversion.h
                  detail/conversion/number_conversion.h
                  detail/default_arguments/default_arguments.h
                  detail/default_arguments/invoke_with_defaults.h
                  detail/destructor/destructor_wrapper.h
                  detail/destructor/destructor_wrapper_base.h
                  detail/enumeration/enumeration_helper.h
+                 detail/enumeration/enumeration_index.h
                  detail/enumeration/enumeration_wrapper.h
                  detail/enumeration/enumeration_wrapper_base.h
                  detail/enumeration/enum_data.h
@@ -88,6 +95,11 @@ set(HEADER_FILES access_levels.h
                  detail/impl/associative_mapper_impl.h
                  detail/impl/enum_flags_impl.h
                  detail/impl/instance_impl.h
+                 detail/impl/method_handle_impl.h
+                 detail/impl/method_impl.h
+                 detail/impl/name_key_impl.h
+                 detail/impl/property_accessor_impl.h
+                 detail/impl/property_impl.h
                  detail/impl/rttr_cast_impl.h
                  detail/impl/sequential_mapper_impl.h
                  detail/impl/string_view_impl.h
@@ -95,10 +107,14 @@ set(HEADER_FILES access_levels.h
                  detail/library/library_p.h
                  detail/metadata/metadata.h
                  detail/metadata/metadata_handler.h
+                 detail/metadata/metadata_index.h
+                 detail/metadata/metadata_key.h
                  detail/method/method_accessor.h
                  detail/method/method_invoker.h
+                 detail/method/method_resolution_cache.h
                  detail/method/method_wrapper.h
                  detail/method/method_wrapper_base.h
+                 detail/method/typed_method_invoker.h
                  detail/misc/argument_wrapper.h
                  detail/misc/argument_extractor.h
                  detail/misc/class_item_mapper.h
@@ -108,6 +124,7 @@ set(HEADER_FILES access_levels.h
                  detail/misc/function_traits.h
                  detail/misc/iterator_wrapper.h
                  detail/misc/misc_type_traits.h
+                 detail/misc/perfect_hash_map.h
                  detail/misc/register_wrapper_mapper_conversion.h
                  detail/misc/sequential_container_type_traits.h
                  detail/misc/std_type_traits.h
@@ -129,6 +146,7 @@ set(HEADER_FILES access_levels.h
                  detail/property/property_wrapper_member_func.h
                  detail/property/property_wrapper_member_object.h
                  detail/property/property_wrapper_object.h
+                 detail/property/typed_property_invoker.h
                  detail/registration/bind_types.h
                  detail/registration/bind_impl.h
                  detail/registration/register_base_class_from_accessor.h
@@ -138,6 +156,7 @@ set(HEADER_FILES access_levels.h
                  detail/registration/registration_state_saver.h
                  detail/type/accessor_type.h
                  detail/type/base_classes.h
+                 detail/type/class_data_impl.h
                  detail/type/get_create_variant_func.h
                  detail/type/get_derived_info_func.h
                  detail/type/type_converter.h
@@ -181,12 +200,14 @@ set(SOURCE_FILES constructor.cpp
                  registration.cpp
                  type.cpp
                  variant.cpp
+                 variant_allocator.cpp
                  variant_associative_view.cpp
                  variant_sequential_view.cpp
                  visitor.cpp
                  detail/comparison/compare_equal.cpp
                  detail/comparison/compare_less.cpp
                  detail/misc/standard_types.cpp
+                 detail/conversion/number_array_conversion.cpp
                  detail/conversion/std_conversion_functions.cpp
                  detail/constructor/constructor_wrapper_base.cpp
                  detail/destructor/destructor_wrapper_base.cpp
@@ -194,6 +215,8 @@ set(SOURCE_FILES constructor.cpp
                  detail/enumeration/enumeration_wrapper_base.cpp
                  detail/library/library_win.cpp
                  detail/library/library_unix.cpp
+                 detail/metadata/metadata_index.cpp
+                 detail/method/method_resolution_cache.cpp
                  detail/method/method_wrapper_base.cpp
                  detail/parameter_info/parameter_info_wrapper_base.cpp
                  detail/property/property_wrapper_base.cpp
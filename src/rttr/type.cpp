@@ -43,6 +43,7 @@
 #include "rttr/detail/parameter_info/parameter_infos_compare.h"
 #include "rttr/detail/filter/filter_item_funcs.h"
 #include "rttr/detail/type/type_register_p.h"
+#include "rttr/detail/type/class_data_impl.h"
 
 #include <algorithm>
 #include <unordered_map>
@@ -60,17 +61,6 @@ using namespace std;
 namespace rttr
 {
 
-namespace detail
-{
-// Private implementation for class_data using PIMPL pattern
-struct class_data_impl
-{
-    std::vector<property>       m_properties;
-    std::vector<method>         m_methods;
-    std::vector<constructor>    m_ctors;
-};
-}
-
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -82,44 +72,30 @@ type::type() noexcept
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-bool type::is_derived_from(const type& other) const noexcept
+static bool is_derived_from_impl(const detail::type_data* src_raw_type,
+                                 const detail::type_data* tgt_raw_type) noexcept
 {
-    auto& src_raw_type = m_type_data->raw_type_data;
-    auto& tgt_raw_type = other.m_type_data->raw_type_data;
-
     if (src_raw_type == tgt_raw_type)
         return true;
 
-    for (auto& t : src_raw_type->m_class_data.m_base_types)
-    {
-        if (t.m_type_data == tgt_raw_type)
-        {
-            return true;
-        }
-    }
-
-    return false;
+    // every base class has a hierarchy index, its bit is set in the mask of all derived classes
+    const auto index = tgt_raw_type->m_class_data.m_hierarchy_index;
+    const auto& mask = src_raw_type->m_class_data.m_base_type_mask;
+    return (index / 64 < mask.size() && (mask[index / 64] & (std::uint64_t(1) << (index % 64))) != 0);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-bool type::is_base_of(const type& other) const noexcept
+bool type::is_derived_from(const type& other) const noexcept
 {
-    auto& src_raw_type = m_type_data->raw_type_data;
-    auto& tgt_raw_type = other.m_type_data->raw_type_data;
-
-    if (src_raw_type == tgt_raw_type)
-        return true;
+    return is_derived_from_impl(m_type_data->raw_type_data, other.m_type_data->raw_type_data);
+}
 
-    for (auto& t : src_raw_type->m_class_data.m_derived_types)
-    {
-        if (t.m_type_data == tgt_raw_type)
-        {
-            return true;
-        }
-    }
+/////////////////////////////////////////////////////////////////////////////////////////
 
-    return false;
+bool type::is_base_of(const type& other) const noexcept
+{
+    return is_derived_from_impl(other.m_type_data->raw_type_data, m_type_data->raw_type_data);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -132,22 +108,36 @@ void* type::apply_offset(void* ptr, const type& source_type, const type& target_
     if (src_raw_type == tgt_raw_type || ptr == nullptr)
         return ptr;
 
-    const detail::derived_info info = src_raw_type->m_class_data.m_derived_info_func(ptr);
-    if (info.m_type.m_type_data->raw_type_data == tgt_raw_type)
-        return info.m_ptr;
-
-    auto& class_list = info.m_type.m_type_data->raw_type_data->m_class_data;
-    int i = 0;
-    for (auto& t : class_list.m_base_types)
+    // casts 'obj', which points to an object of class 'class_type', to its base class 'tgt_raw_type'
+    const auto cast_to_base_class = [tgt_raw_type](void* obj, const detail::type_data* class_type) noexcept -> void*
     {
-        if (t.m_type_data == tgt_raw_type)
+        if (!is_derived_from_impl(class_type, tgt_raw_type))
+            return nullptr;
+
+        auto& class_data = class_type->m_class_data;
+        const auto& base_types = class_data.m_base_types;
+        for (std::size_t i = 0; i < base_types.size(); ++i)
         {
-            return class_list.m_conversion_list[i](info.m_ptr);
+            if (base_types[i].m_type_data == tgt_raw_type)
+                return class_data.m_conversion_list[i](obj);
         }
-        ++i;
-    }
 
-    return nullptr;
+        return nullptr;
+    };
+
+    // an upcast does not need the most derived object
+    if (void* result = cast_to_base_class(ptr, src_raw_type))
+        return result;
+
+    const detail::derived_info info = src_raw_type->m_class_data.m_derived_info_func(ptr);
+    const auto derived_raw_type = info.m_type.m_type_data->raw_type_data;
+    if (derived_raw_type == tgt_raw_type)
+        return info.m_ptr;
+
+    if (derived_raw_type == src_raw_type)
+        return nullptr;
+
+    return cast_to_base_class(info.m_ptr, derived_raw_type);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -182,8 +172,7 @@ array_range<type> type::get_derived_classes() const noexcept
 
 array_range<type> type::get_types() noexcept
 {
-    auto& type_list = detail::type_register_private::get_instance().get_type_storage();
-    return array_range<type>(&type_list[1], type_list.size() - 1);
+    return detail::type_register_private::get_instance().get_type_storage();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -198,7 +187,17 @@ array_range<type> type::get_template_arguments() const noexcept
 
 variant type::get_metadata(const variant& key) const
 {
-    return detail::type_register_private::get_metadata(*this, key);
+    if (const variant* value = get_metadata_value(detail::make_metadata_key(key)))
+        return *value;
+    else
+        return variant();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+const variant* type::get_metadata_value(const detail::metadata_key& key) const noexcept
+{
+    return detail::type_register_private::get_metadata_value(*this, key);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -234,16 +233,37 @@ bool type::destroy(variant& obj) const noexcept
 property type::get_property(string_view name) const noexcept
 {
     const auto raw_t = get_raw_type();
-    const auto& vec = raw_t.m_type_data->m_class_data.m_impl->m_properties;
-    // properties are ordered from base to derived
-    // use reverse iterator to find the most-derived propertie
-    // when searching instance registry by name
-    auto ret = std::find_if(vec.crbegin(), vec.crend(),
-                            [name](const property& item)
-                            {
-                                return (item.get_name() == name);
-                            });
-    if (ret != vec.crend())
+    const auto& class_impl = *raw_t.m_type_data->m_class_data.m_impl;
+    if (const auto frozen = class_impl.m_frozen_index.load(std::memory_order_acquire))
+    {
+        const auto prop = frozen->m_properties.find(name, detail::generate_hash(name.data(), name.size()));
+        return (prop ? *prop : detail::create_invalid_item<property>());
+    }
+
+    // the index contains for every name the most-derived property
+    const auto& index = class_impl.m_property_index;
+    const auto ret = index.find(name);
+    if (ret != index.end())
+        return *ret;
+
+    return detail::create_invalid_item<property>();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+property type::get_property(const name_key& key) const noexcept
+{
+    const auto raw_t = get_raw_type();
+    const auto& class_impl = *raw_t.m_type_data->m_class_data.m_impl;
+    if (const auto frozen = class_impl.m_frozen_index.load(std::memory_order_acquire))
+    {
+        const auto prop = frozen->m_properties.find(key.get_name(), key.get_hash());
+        return (prop ? *prop : detail::create_invalid_item<property>());
+    }
+
+    const auto& index = class_impl.m_property_index;
+    const auto ret = index.find(key.get_name(), key.get_hash());
+    if (ret != index.end())
         return *ret;
 
     return detail::create_invalid_item<property>();
@@ -284,17 +304,7 @@ bool type::set_property_value(string_view name, argument arg)
 
 array_range<property> type::get_properties() const noexcept
 {
-    auto& vec = get_raw_type().m_type_data->m_class_data.m_impl->m_properties;
-    if (!vec.empty())
-    {
-        return array_range<property>(vec.data(), vec.size(),
-                                     detail::default_predicate<property>([](const property& prop)
-                                     {
-                                         return (prop.get_access_level() == access_levels::public_access);
-                                     }) );
-    }
-
-    return array_range<property>();
+    return get_properties(filter_item::instance_item | filter_item::static_item | filter_item::public_access);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -302,11 +312,8 @@ array_range<property> type::get_properties() const noexcept
 array_range<property> type::get_properties(filter_items filter) const noexcept
 {
     const auto raw_t = get_raw_type();
-    auto& vec = raw_t.m_type_data->m_class_data.m_impl->m_properties;
-    if (!vec.empty())
-        return array_range<property>(vec.data(), vec.size(), detail::get_filter_predicate<property>(raw_t, filter));
-
-    return array_range<property>();
+    auto& class_impl = *raw_t.m_type_data->m_class_data.m_impl;
+    return detail::get_filtered_items(class_impl.m_properties, raw_t, filter, class_impl.m_filtered_properties);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -314,16 +321,37 @@ array_range<property> type::get_properties(filter_items filter) const noexcept
 method type::get_method(string_view name) const noexcept
 {
     const auto raw_t = get_raw_type();
-    const auto& vec = raw_t.m_type_data->m_class_data.m_impl->m_methods;
-    // methods appear are ordered from base to derived
-    // use reverse iterator to find the most-derived method
-    // when searching instance registry by name
-    auto ret = std::find_if(vec.crbegin(), vec.crend(),
-                            [name](const method& item)
-                            {
-                                return (item.get_name() == name);
-                            });
-    if (ret != vec.crend())
+    const auto& class_impl = *raw_t.m_type_data->m_class_data.m_impl;
+    if (const auto frozen = class_impl.m_frozen_index.load(std::memory_order_acquire))
+    {
+        const auto meth = frozen->m_methods.find(name, detail::generate_hash(name.data(), name.size()));
+        return (meth ? *meth : detail::create_invalid_item<method>());
+    }
+
+    // the index contains for every name the most-derived method
+    const auto& index = class_impl.m_method_index;
+    const auto ret = index.find(name);
+    if (ret != index.end())
+        return *ret;
+
+    return detail::create_invalid_item<method>();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+method type::get_method(const name_key& key) const noexcept
+{
+    const auto raw_t = get_raw_type();
+    const auto& class_impl = *raw_t.m_type_data->m_class_data.m_impl;
+    if (const auto frozen = class_impl.m_frozen_index.load(std::memory_order_acquire))
+    {
+        const auto meth = frozen->m_methods.find(key.get_name(), key.get_hash());
+        return (meth ? *meth : detail::create_invalid_item<method>());
+    }
+
+    const auto& index = class_impl.m_method_index;
+    const auto ret = index.find(key.get_name(), key.get_hash());
+    if (ret != index.end())
         return *ret;
 
     return detail::create_invalid_item<method>();
@@ -333,37 +361,35 @@ method type::get_method(string_view name) const noexcept
 
 method type::get_method(string_view name, const std::vector<type>& type_list) const noexcept
 {
+    using match_kind = detail::method_resolution_cache::match_kind;
+
     const auto raw_t = get_raw_type();
-    const auto& methvec = raw_t.m_type_data->m_class_data.m_impl->m_methods;
+    auto& class_impl = *raw_t.m_type_data->m_class_data.m_impl;
+    auto result = detail::create_invalid_item<method>();
+    if (class_impl.m_method_resolution_cache.find(match_kind::type_list, name, type_list, result))
+        return result;
+
+    const auto& methvec = class_impl.m_methods;
     for (auto mit = methvec.crbegin() ; mit != methvec.crend() ; ++mit)
     {
         const auto& meth = *mit ;
         if ( meth.get_name() == name &&
              detail::compare_with_type_list::compare(meth.get_parameter_infos(), type_list))
         {
-            return meth;
+            result = meth;
+            break;
         }
     }
 
-    return detail::create_invalid_item<method>();
+    class_impl.m_method_resolution_cache.insert(match_kind::type_list, name, type_list, result);
+    return result;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 array_range<method> type::get_methods() const noexcept
 {
-    const auto raw_t = get_raw_type();
-    auto& vec = raw_t.m_type_data->m_class_data.m_impl->m_methods;
-    if (!vec.empty())
-    {
-        return array_range<method>(vec.data(), vec.size(),
-                                   detail::default_predicate<method>([](const method& meth)
-                                   {
-                                        return (meth.get_access_level() == access_levels::public_access);
-                                   }) );
-    }
-
-    return array_range<method>();
+    return get_methods(filter_item::instance_item | filter_item::static_item | filter_item::public_access);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -371,11 +397,8 @@ array_range<method> type::get_methods() const noexcept
 array_range<method> type::get_methods(filter_items filter) const noexcept
 {
     const auto raw_t = get_raw_type();
-    auto& vec = raw_t.m_type_data->m_class_data.m_impl->m_methods;
-    if (!vec.empty())
-        return array_range<method>(vec.data(), vec.size(), detail::get_filter_predicate<method>(raw_t, filter));
-
-    return array_range<method>();
+    auto& class_impl = *raw_t.m_type_data->m_class_data.m_impl;
+    return detail::get_filtered_items(class_impl.m_methods, raw_t, filter, class_impl.m_filtered_methods);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -453,18 +476,30 @@ enumeration type::get_enumeration() const noexcept
 
 variant type::invoke(string_view name, instance obj, std::vector<argument> args) const
 {
+    using match_kind = detail::method_resolution_cache::match_kind;
+
     const auto raw_t = get_raw_type();
-    const auto& methvec = raw_t.m_type_data->m_class_data.m_impl->m_methods;
-    for (auto mit = methvec.crbegin() ; mit != methvec.crend() ; ++mit)
+    auto& class_impl = *raw_t.m_type_data->m_class_data.m_impl;
+    auto meth = detail::create_invalid_item<method>();
+    if (!class_impl.m_method_resolution_cache.find(match_kind::arg_list, name, args, meth))
     {
-        const auto& meth = *mit ;
-        if ( meth.get_name() == name &&
-             detail::compare_with_arg_list::compare(meth.get_parameter_infos(), args))
+        const auto& methvec = class_impl.m_methods;
+        for (auto mit = methvec.crbegin() ; mit != methvec.crend() ; ++mit)
         {
-            return meth.invoke_variadic(obj, args);
+            if ( mit->get_name() == name &&
+                 detail::compare_with_arg_list::compare(mit->get_parameter_infos(), args))
+            {
+                meth = *mit;
+                break;
+            }
         }
+
+        class_impl.m_method_resolution_cache.insert(match_kind::arg_list, name, args, meth);
     }
 
+    if (meth)
+        return meth.invoke_variadic(obj, args);
+
     return variant();
 }
 
@@ -495,12 +530,14 @@ variant type::invoke(string_view name, std::vector<argument> args)
 
 type type::get_by_name(string_view name) noexcept
 {
-    auto& custom_name_to_id = detail::type_register_private::get_instance().get_custom_name_to_id();
-    auto ret = custom_name_to_id.find(name);
-    if (ret != custom_name_to_id.end())
-        return (*ret);
+    return detail::type_register_private::get_instance().get_by_name(name, detail::generate_hash(name.data(), name.size()));
+}
 
-    return detail::get_invalid_type();
+/////////////////////////////////////////////////////////////////////////////////////////
+
+type type::get_by_name(const name_key& key) noexcept
+{
+    return detail::type_register_private::get_instance().get_by_name(key.get_name(), key.get_hash());
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -542,28 +579,15 @@ constructor type::get_constructor(const std::vector<type>& args) const noexcept
 
 array_range<constructor> type::get_constructors() const noexcept
 {
-    auto& ctors = m_type_data->m_class_data.m_impl->m_ctors;
-    if (!ctors.empty())
-    {
-        return array_range<constructor>(ctors.data(), ctors.size(),
-                                        detail::default_predicate<constructor>([](const constructor& ctor)
-                                        {
-                                            return (ctor.get_access_level() == access_levels::public_access);
-                                        }) );
-    }
-
-    return array_range<constructor>();
+    return get_constructors(filter_item::instance_item | filter_item::public_access);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 array_range<constructor> type::get_constructors(filter_items filter) const noexcept
 {
-    auto& ctors = m_type_data->m_class_data.m_impl->m_ctors;
-    if (!ctors.empty())
-        return array_range<constructor>(ctors.data(), ctors.size(), detail::get_filter_predicate<constructor>(*this, filter));
-
-    return array_range<constructor>();
+    auto& class_impl = *m_type_data->m_class_data.m_impl;
+    return detail::get_filtered_items(class_impl.m_ctors, *this, filter, class_impl.m_filtered_ctors);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
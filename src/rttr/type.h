@@ -30,6 +30,7 @@
 
 #include "rttr/detail/base/core_prerequisites.h"
 #include "rttr/string_view.h"
+#include "rttr/name_key.h"
 #include "rttr/array_range.h"
 #include "rttr/filter_item.h"
 
@@ -72,6 +73,8 @@ struct class_data;
 class destructor_wrapper_base;
 class property_wrapper_base;
 RTTR_LOCAL inline type create_type(type_data*) noexcept;
+RTTR_LOCAL inline std::size_t get_basic_type_index(const type&) noexcept;
+struct metadata_key;
 
 template<typename T>
 RTTR_LOCAL std::unique_ptr<type_data> make_type_data();
@@ -307,6 +310,15 @@ class RTTR_API type
          */
         static type get_by_name(string_view name) noexcept;
 
+        /*!
+         * \brief Returns the type object with the name of the given \p key.
+         *
+         * Same as \ref get_by_name(string_view), but the hash of the name is taken from the key.
+         *
+         * \return \ref type object with the name of \p key.
+         */
+        static type get_by_name(const name_key& key) noexcept;
+
         /*!
          * \brief Returns a range of all registered type objects.
          *
@@ -572,6 +584,20 @@ class RTTR_API type
          */
         variant get_metadata(const variant& key) const;
 
+        /*!
+         * \brief Returns a pointer to the meta data value for the given key \p key, when the value is of type \p T.
+         *
+         * In contrast to \ref get_metadata(const variant&) const, the value is not copied into a \ref variant
+         * and for integral, enum and string keys also no \ref variant for the key is created.
+         *
+         * \remark When no meta data is registered with the given \p key, or its value is not of type \p T,
+         *         a `nullptr` is returned.
+         *
+         * \return A pointer to the meta data value.
+         */
+        template<typename T, typename Key>
+        const T* get_metadata(const Key& key) const;
+
         /*!
          * \brief Returns a public constructor whose parameters match the types in the specified list.
          *
@@ -685,6 +711,16 @@ class RTTR_API type
          */
         property get_property(string_view name) const noexcept;
 
+        /*!
+         * \brief Returns a property with the name of the given \p key.
+         *
+         * Same as \ref get_property(string_view), but the hash of the name is taken from the key;
+         * a key of a string literal is therefore hashed at compile time.
+         *
+         * \return A property with the name of \p key.
+         */
+        property get_property(const name_key& key) const noexcept;
+
         /*!
          * \brief Returns a range of all registered *public* properties for this type and
          *        all its base classes.
@@ -815,6 +851,16 @@ class RTTR_API type
          */
         method get_method(string_view name) const noexcept;
 
+        /*!
+         * \brief Returns a method with the name of the given \p key.
+         *
+         * Same as \ref get_method(string_view), but the hash of the name is taken from the key;
+         * a key of a string literal is therefore hashed at compile time.
+         *
+         * \return A method with the name of \p key.
+         */
+        method get_method(const name_key& key) const noexcept;
+
         /*!
          * \brief Returns a method with the name \p name which match the given parameter type list \p type_list.
          *
@@ -1171,6 +1217,11 @@ class RTTR_API type
          */
         void visit(visitor& visitor, detail::type_of_visit visit_type) const noexcept;
 
+        /*!
+         * \brief Returns a pointer to the meta data value for the given key \p key, or a `nullptr`.
+         */
+        const variant* get_metadata_value(const detail::metadata_key& key) const noexcept;
+
         /////////////////////////////////////////////////////////////////////////////////
         /////////////////////////////////////////////////////////////////////////////////
         /////////////////////////////////////////////////////////////////////////////////
@@ -1189,6 +1240,7 @@ class RTTR_API type
         friend struct detail::class_data;
 
         friend type detail::create_type(detail::type_data*) noexcept;
+        friend std::size_t detail::get_basic_type_index(const type&) noexcept;
 
         template<typename T>
         friend std::unique_ptr<detail::type_data> detail::make_type_data();
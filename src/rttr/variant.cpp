@@ -33,6 +33,7 @@
 #include "rttr/argument.h"
 
 #include <algorithm>
+#include <array>
 #include <limits>
 #include <string>
 #include <set>
@@ -262,6 +263,19 @@ bool variant::can_convert(const type& target_type) const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+template<typename T>
+bool variant::convert_to_basic_type(const variant& source, variant& target)
+{
+    T value;
+    if (!source.try_basic_type_conversion(value))
+        return false;
+
+    target = std::move(value);
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 bool variant::convert(const type& target_type, variant& target_var) const
 {
     if (!is_valid())
@@ -271,7 +285,7 @@ bool variant::convert(const type& target_type, variant& target_var) const
 
     const type source_type = get_type();
     const bool source_is_arithmetic = source_type.is_arithmetic();
-    const bool target_is_arithmetic = target_type.is_arithmetic();
+    const std::size_t target_index = detail::get_basic_type_index(target_type);
     const type string_type = type::get<std::string>();
     if (target_type == source_type)
     {
@@ -290,90 +304,17 @@ bool variant::convert(const type& target_type, variant& target_var) const
         ok = var.convert(target_type);
         target_var = var;
     }
-    else if ((source_is_arithmetic && target_is_arithmetic) ||
-            (source_is_arithmetic && target_type == string_type) ||
-            (source_type == string_type && target_is_arithmetic) ||
-            (source_type.is_enumeration() && target_is_arithmetic) ||
-            (source_type.is_enumeration() && target_type == string_type))
+    else if (target_index != detail::invalid_basic_type_index &&
+             (source_is_arithmetic || source_type == string_type || source_type.is_enumeration()))
     {
-        if (target_type == type::get<bool>())
-        {
-            bool value;
-            if ((ok = try_basic_type_conversion(value)) == true)
-                target_var = value;
-        }
-        else if (target_type == type::get<char>())
-        {
-            char value;
-            if ((ok = try_basic_type_conversion(value)) == true)
-                target_var = value;
-        }
-        else if (target_type == type::get<int8_t>())
-        {
-            int8_t value;
-            if ((ok = try_basic_type_conversion(value)) == true)
-                target_var = value;
-        }
-        else if (target_type == type::get<int16_t>())
-        {
-            int16_t value;
-            if ((ok = try_basic_type_conversion(value)) == true)
-                target_var = value;
-        }
-        else if (target_type == type::get<int32_t>())
+        // one indexed call, instead of comparing the target type against every basic type
+        static constexpr auto basic_conversion_table = []<typename... T>(type_list<T...>)
         {
-            int32_t value;
-            if ((ok = try_basic_type_conversion(value)) == true)
-                target_var = value;
-        }
-        else if (target_type == type::get<int64_t>())
-        {
-            int64_t value;
-            if ((ok = try_basic_type_conversion(value)) == true)
-                target_var = value;
-        }
-        else if (target_type == type::get<uint8_t>())
-        {
-            uint8_t value;
-            if ((ok = try_basic_type_conversion(value)) == true)
-                target_var = value;
-        }
-        else if (target_type == type::get<uint16_t>())
-        {
-            uint16_t value;
-            if ((ok = try_basic_type_conversion(value)) == true)
-                target_var = value;
-        }
-        else if (target_type == type::get<uint32_t>())
-        {
-            uint32_t value;
-            if ((ok = try_basic_type_conversion(value)) == true)
-                target_var = value;
-        }
-        else if (target_type == type::get<uint64_t>())
-        {
-            uint64_t value;
-            if ((ok = try_basic_type_conversion(value)) == true)
-                target_var = value;
-        }
-        else if (target_type == type::get<float>())
-        {
-            float value;
-            if ((ok = try_basic_type_conversion(value)) == true)
-                target_var = value;
-        }
-        else if (target_type == type::get<double>())
-        {
-            double value;
-            if ((ok = try_basic_type_conversion(value)) == true)
-                target_var = value;
-        }
-        else if (target_type == string_type)
-        {
-            std::string value;
-            if ((ok = try_basic_type_conversion(value)) == true)
-                target_var = std::move(value);
-        }
+            using conversion_func = bool (*)(const variant&, variant&);
+            return std::array<conversion_func, sizeof...(T)>{{ &variant::convert_to_basic_type<T>... }};
+        }(detail::basic_type_list());
+
+        ok = basic_conversion_table[target_index](*this, target_var);
     }
     else if ((source_is_arithmetic || source_type == string_type)
              && target_type.is_enumeration())
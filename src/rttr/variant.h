@@ -997,6 +997,14 @@ class RTTR_API variant
         template<typename T>
         bool try_basic_type_conversion(T& to) const;
 
+        /*!
+         * \brief Converts the internal value of \p source to the basic type \p T and stores it in \p target.
+         *
+         * \return `True`, when the conversion was successful, otherwise `false`.
+         */
+        template<typename T>
+        static bool convert_to_basic_type(const variant& source, variant& target);
+
         /*!
          * \brief Tries to convert the internal pointer type to the given pointer type \p T.
          *
@@ -0,0 +1,399 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "rttr/variant_allocator.h"
+
+#include "rttr/detail/misc/utility.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace rttr
+{
+namespace detail
+{
+
+/*!
+ * The allocation counters of one thread.
+ *
+ * Only the owning thread writes its counters, so they are incremented without a read-modify-write
+ * and no cache line is shared between threads; \ref get_variant_allocator_stats() sums up the counters of all threads.
+ */
+struct allocator_counters
+{
+    std::atomic<std::size_t> allocations{0};
+    std::atomic<std::size_t> deallocations{0};
+    std::atomic<std::size_t> pool_hits{0};
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * All living thread counters and the sum of the counters of all finished threads.
+ */
+class allocator_counter_registry
+{
+public:
+    static allocator_counter_registry& get_instance() noexcept
+    {
+        // never destroyed, because threads may still finish while the static objects are destroyed
+        static auto registry = new allocator_counter_registry();
+        return *registry;
+    }
+
+    void add(const allocator_counters* counters)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_counters.push_back(counters);
+    }
+
+    //! Removes \p counters of a finished thread, their values are kept in the total.
+    void remove(const allocator_counters* counters) noexcept
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_finished.allocations      += counters->allocations.load(std::memory_order_relaxed);
+        m_finished.deallocations    += counters->deallocations.load(std::memory_order_relaxed);
+        m_finished.pool_hits        += counters->pool_hits.load(std::memory_order_relaxed);
+        m_counters.erase(std::remove(m_counters.begin(), m_counters.end(), counters), m_counters.end());
+    }
+
+    variant_allocator_stats get_stats() noexcept
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const auto total = get_total();
+        return {total.allocations - m_reset.allocations,
+                total.deallocations - m_reset.deallocations,
+                total.pool_hits - m_reset.pool_hits};
+    }
+
+    //! The counters of the threads are not modified; the current total is subtracted from every later result instead.
+    void reset() noexcept
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_reset = get_total();
+    }
+
+    //! Counts the allocations of threads, whose counters are already destroyed; shared by all threads.
+    allocator_counters m_untracked;
+
+private:
+    variant_allocator_stats get_total() const noexcept
+    {
+        auto total = m_finished;
+        for (const auto counters : m_counters)
+        {
+            total.allocations   += counters->allocations.load(std::memory_order_relaxed);
+            total.deallocations += counters->deallocations.load(std::memory_order_relaxed);
+            total.pool_hits     += counters->pool_hits.load(std::memory_order_relaxed);
+        }
+
+        total.allocations   += m_untracked.allocations.load(std::memory_order_relaxed);
+        total.deallocations += m_untracked.deallocations.load(std::memory_order_relaxed);
+        total.pool_hits     += m_untracked.pool_hits.load(std::memory_order_relaxed);
+        return total;
+    }
+
+    std::mutex                                  m_mutex;
+    std::vector<const allocator_counters*>      m_counters;
+    variant_allocator_stats                     m_finished = {0, 0, 0};
+    variant_allocator_stats                     m_reset = {0, 0, 0};
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The counters of the calling thread; they are registered with the first allocation of the thread.
+ */
+class thread_allocator_counters
+{
+public:
+    thread_allocator_counters()
+    {
+        allocator_counter_registry::get_instance().add(&m_counters);
+    }
+
+    ~thread_allocator_counters()
+    {
+        allocator_counter_registry::get_instance().remove(&m_counters);
+        s_destroyed = true;
+    }
+
+    //! Increments the given \p counter of the calling thread.
+    static void increment(std::atomic<std::size_t> allocator_counters::* counter) noexcept
+    {
+        if (s_destroyed)
+        {
+            (allocator_counter_registry::get_instance().m_untracked.*counter).fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        static thread_local thread_allocator_counters counters;
+        auto& value = counters.m_counters.*counter;
+        value.store(value.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+private:
+    allocator_counters m_counters;
+
+    static thread_local bool s_destroyed;
+};
+
+thread_local bool thread_allocator_counters::s_destroyed = false;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * A thread local cache of freed variant blocks, separated into size classes.
+ *
+ * Every block is allocated with its own `operator new` call, so a block can be freed
+ * into the pool of any thread and is released with `operator delete` at thread exit.
+ */
+class variant_data_pool
+{
+public:
+    static constexpr std::size_t granularity = 16;
+    static constexpr std::size_t class_count = 16;
+    static constexpr std::size_t max_cached_blocks = 64;
+
+    ~variant_data_pool()
+    {
+        for (auto& size_class : m_classes)
+        {
+            while (size_class.head)
+            {
+                auto block = size_class.head;
+                size_class.head = block->next;
+                ::operator delete(block);
+            }
+        }
+
+        s_destroyed = true;
+    }
+
+    //! Returns the pool of the calling thread or a `nullptr` when the thread is shutting down.
+    static variant_data_pool* get_instance() noexcept
+    {
+        if (s_destroyed)
+            return nullptr;
+
+        static thread_local variant_data_pool pool;
+        return &pool;
+    }
+
+    static bool is_pooled(std::size_t size, std::size_t alignment) noexcept
+    {
+        return (size <= granularity * class_count && alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+    }
+
+    static std::size_t get_class_index(std::size_t size) noexcept
+    {
+        return (size == 0 ? 0 : (size - 1) / granularity);
+    }
+
+    void* allocate(std::size_t index, bool& from_pool)
+    {
+        auto& size_class = m_classes[index];
+        if (auto block = size_class.head)
+        {
+            size_class.head = block->next;
+            --size_class.count;
+            from_pool = true;
+            return block;
+        }
+
+        from_pool = false;
+        return ::operator new((index + 1) * granularity);
+    }
+
+    void deallocate(void* ptr, std::size_t index) noexcept
+    {
+        auto& size_class = m_classes[index];
+        if (size_class.count == max_cached_blocks)
+        {
+            ::operator delete(ptr);
+            return;
+        }
+
+        auto block = static_cast<free_block*>(ptr);
+        block->next = size_class.head;
+        size_class.head = block;
+        ++size_class.count;
+    }
+
+private:
+    struct free_block
+    {
+        free_block* next;
+    };
+
+    struct size_class
+    {
+        free_block* head    = nullptr;
+        std::size_t count   = 0;
+    };
+
+    std::array<size_class, class_count> m_classes;
+
+    static thread_local bool s_destroyed;
+};
+
+thread_local bool variant_data_pool::s_destroyed = false;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static void* pool_allocate(std::size_t size, std::size_t alignment);
+static void pool_deallocate(void* ptr, std::size_t size, std::size_t alignment) noexcept;
+
+static const variant_allocator g_default_allocator = {&pool_allocate, &pool_deallocate};
+
+/*!
+ * The installed allocator; both functions are published together with one pointer,
+ * so a reader never sees the allocate function of one allocator and the deallocate function of another one.
+ */
+static std::atomic<const variant_allocator*> g_allocator(&g_default_allocator);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static void* pool_allocate(std::size_t size, std::size_t alignment)
+{
+    if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+        return ::operator new(size, std::align_val_t(alignment));
+
+    if (!variant_data_pool::is_pooled(size, alignment))
+        return ::operator new(size);
+
+    // the block is always rounded up to its size class, it might be cached by another thread later on
+    const auto index = variant_data_pool::get_class_index(size);
+    auto pool = variant_data_pool::get_instance();
+    if (!pool)
+        return ::operator new((index + 1) * variant_data_pool::granularity);
+
+    bool from_pool = false;
+    auto ptr = pool->allocate(index, from_pool);
+    if (from_pool)
+        thread_allocator_counters::increment(&allocator_counters::pool_hits);
+
+    return ptr;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static void pool_deallocate(void* ptr, std::size_t size, std::size_t alignment) noexcept
+{
+    if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+    {
+        ::operator delete(ptr, std::align_val_t(alignment));
+        return;
+    }
+
+    auto pool = variant_data_pool::is_pooled(size, alignment) ? variant_data_pool::get_instance() : nullptr;
+    if (!pool)
+    {
+        ::operator delete(ptr);
+        return;
+    }
+
+    pool->deallocate(ptr, variant_data_pool::get_class_index(size));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void* allocate_variant_data(std::size_t size, std::size_t alignment)
+{
+    auto ptr = g_allocator.load(std::memory_order_acquire)->allocate(size, alignment);
+    thread_allocator_counters::increment(&allocator_counters::allocations);
+    return ptr;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void deallocate_variant_data(void* ptr, std::size_t size, std::size_t alignment) noexcept
+{
+    g_allocator.load(std::memory_order_acquire)->deallocate(ptr, size, alignment);
+    thread_allocator_counters::increment(&allocator_counters::deallocations);
+}
+
+} // end namespace detail
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void set_variant_allocator(const variant_allocator& allocator) noexcept
+{
+    if (!allocator.allocate || !allocator.deallocate)
+    {
+        detail::g_allocator.store(&detail::g_default_allocator, std::memory_order_release);
+        return;
+    }
+
+    // an installed allocator is never released, because another thread might just have loaded it
+    static std::mutex mutex;
+    static std::vector<std::unique_ptr<const variant_allocator>> allocator_list;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    allocator_list.push_back(detail::make_unique<const variant_allocator>(allocator));
+    detail::g_allocator.store(allocator_list.back().get(), std::memory_order_release);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_allocator get_variant_allocator() noexcept
+{
+    return *detail::g_allocator.load(std::memory_order_acquire);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_allocator get_default_variant_allocator() noexcept
+{
+    return detail::g_default_allocator;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_allocator_stats get_variant_allocator_stats() noexcept
+{
+    return detail::allocator_counter_registry::get_instance().get_stats();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void reset_variant_allocator_stats() noexcept
+{
+    detail::allocator_counter_registry::get_instance().reset();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace rttr
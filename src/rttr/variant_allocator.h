@@ -0,0 +1,122 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_VARIANT_ALLOCATOR_H_
+#define RTTR_VARIANT_ALLOCATOR_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#include <cstddef>
+
+namespace rttr
+{
+
+/*!
+ * The \ref variant_allocator is used by \ref variant to allocate the storage of all values,
+ * which do not fit into the inline buffer of the variant (see the CMake option `RTTR_VARIANT_BUFFER_SIZE`).
+ *
+ * By default a thread local pool is used. Freed blocks up to 256 bytes are kept in free lists with a
+ * granularity of 16 bytes and reused for the next allocation of the same size class; bigger or over-aligned
+ * blocks are forwarded to `operator new`. A block may be freed by another thread than it was allocated from.
+ *
+ * A custom allocator can be installed with \ref set_variant_allocator().
+ *
+ * \remark The allocator has to be set before any variant allocates its value; a block is always
+ *         released with the allocator which is active at the time of destruction.
+ */
+struct variant_allocator
+{
+    //! Returns a block of at least \p size bytes aligned to \p alignment; throws `std::bad_alloc` on failure.
+    using allocate_func = void* (*)(std::size_t size, std::size_t alignment);
+    //! Releases a block returned by `allocate_func` with the same \p size and \p alignment.
+    using deallocate_func = void (*)(void* ptr, std::size_t size, std::size_t alignment) noexcept;
+
+    allocate_func   allocate;
+    deallocate_func deallocate;
+};
+
+/*!
+ * The counters of all heap allocations done for variant values, since program start
+ * or the last call to \ref reset_variant_allocator_stats().
+ *
+ * Every thread counts its own allocations; the counters of all threads are summed up, when the stats are retrieved.
+ */
+struct variant_allocator_stats
+{
+    //! The number of allocated blocks.
+    std::size_t allocations;
+    //! The number of released blocks.
+    std::size_t deallocations;
+    //! The number of allocations, which were served from the free lists of the default pool.
+    std::size_t pool_hits;
+};
+
+/*!
+ * \brief Installs the given \p allocator for all heap allocations of variant values.
+ *
+ * When one of both functions is a `nullptr`, the default pool allocator will be used.
+ * Both functions are installed together, another thread never uses one without the other.
+ */
+RTTR_API void set_variant_allocator(const variant_allocator& allocator) noexcept;
+
+/*!
+ * \brief Returns the currently installed allocator for variant values.
+ */
+RTTR_API variant_allocator get_variant_allocator() noexcept;
+
+/*!
+ * \brief Returns the default allocator for variant values, which uses a thread local pool.
+ */
+RTTR_API variant_allocator get_default_variant_allocator() noexcept;
+
+/*!
+ * \brief Returns the current allocation counters of variant values.
+ */
+RTTR_API variant_allocator_stats get_variant_allocator_stats() noexcept;
+
+/*!
+ * \brief Sets all allocation counters of variant values back to zero.
+ */
+RTTR_API void reset_variant_allocator_stats() noexcept;
+
+namespace detail
+{
+
+/*!
+ * Allocates the storage of a variant value, which does not fit into \ref variant_data.
+ */
+RTTR_API void* allocate_variant_data(std::size_t size, std::size_t alignment);
+
+/*!
+ * Releases the storage of a variant value, which was returned by \ref allocate_variant_data.
+ */
+RTTR_API void deallocate_variant_data(void* ptr, std::size_t size, std::size_t alignment) noexcept;
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_VARIANT_ALLOCATOR_H_
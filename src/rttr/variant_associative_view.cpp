@@ -31,6 +31,9 @@
 #include "rttr/argument.h"
 #include "rttr/instance.h"
 
+#include <utility>
+#include <vector>
+
 using namespace std;
 
 namespace rttr
@@ -129,6 +132,13 @@ std::size_t variant_associative_view::get_size() const noexcept
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+bool variant_associative_view::reserve(std::size_t size)
+{
+    return m_view.reserve(size);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 std::pair<variant_associative_view::const_iterator, bool> variant_associative_view::insert(argument key)
 {
     const_iterator itr(&m_view);
@@ -151,6 +161,117 @@ std::pair<variant_associative_view::const_iterator, bool> variant_associative_vi
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+std::size_t variant_associative_view::insert(const variant_sequential_view& keys)
+{
+    if (!is_key_only_type())
+        return 0;
+
+    m_view.reserve(m_view.get_size() + keys.get_size());
+
+    const auto key_data = keys.get_contiguous_data();
+    if (key_data && key_data.get_value_type() == m_view.get_key_type())
+        return m_view.insert_range(key_data.get_data(), nullptr, key_data.get_size());
+
+    std::size_t count = 0;
+    for (const auto& item : keys)
+    {
+        const variant key = item.get_type().is_wrapper() ? item.extract_wrapped_value() : item;
+        count += insert(key).second;
+    }
+
+    return count;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t variant_associative_view::insert(const variant_sequential_view& keys, const variant_sequential_view& values)
+{
+    if (is_key_only_type() || keys.get_size() != values.get_size())
+        return 0;
+
+    m_view.reserve(m_view.get_size() + keys.get_size());
+
+    const auto key_data = keys.get_contiguous_data();
+    const auto value_data = values.get_contiguous_data();
+    if (key_data && key_data.get_value_type() == m_view.get_key_type() &&
+        value_data && value_data.get_value_type() == m_view.get_value_type())
+    {
+        return m_view.insert_range(key_data.get_data(), value_data.get_data(), key_data.get_size());
+    }
+
+    std::size_t count = 0;
+    auto itr_value = values.begin();
+    for (const auto& item : keys)
+    {
+        const variant key = item.get_type().is_wrapper() ? item.extract_wrapped_value() : item;
+        const variant item_value = *itr_value;
+        const variant value = item_value.get_type().is_wrapper() ? item_value.extract_wrapped_value() : item_value;
+        count += insert(key, value).second;
+        ++itr_value;
+    }
+
+    return count;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t variant_associative_view::insert(const variant_associative_view& other)
+{
+    return insert(other.begin(), other.end());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t variant_associative_view::insert(const const_iterator& first, const const_iterator& last)
+{
+    const bool key_only = is_key_only_type();
+
+    // an insertion into the container can invalidate the iterators of the range (e.g. when an unordered container rehashes),
+    // so the elements of this container are copied first
+    if (first.m_view && m_view.is_same_container(*first.m_view))
+    {
+        std::vector<std::pair<variant, variant>> items;
+        for (auto itr = first; itr != last; ++itr)
+        {
+            items.emplace_back(itr.get_key().extract_wrapped_value(),
+                               key_only ? variant() : itr.get_value().extract_wrapped_value());
+        }
+
+        m_view.reserve(m_view.get_size() + items.size());
+
+        std::size_t count = 0;
+        for (const auto& item : items)
+            count += (key_only ? insert(item.first).second : insert(item.first, item.second).second);
+
+        return count;
+    }
+
+    std::size_t size = 0;
+    for (auto itr = first; itr != last; ++itr)
+        ++size;
+
+    m_view.reserve(m_view.get_size() + size);
+
+    std::size_t count = 0;
+    for (auto itr = first; itr != last; ++itr)
+    {
+        const variant key = itr.get_key().extract_wrapped_value();
+        if (key_only)
+        {
+            count += insert(key).second;
+        }
+        else
+        {
+            const variant value = itr.get_value().extract_wrapped_value();
+            count += insert(key, value).second;
+        }
+    }
+
+    return count;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 variant_associative_view::const_iterator variant_associative_view::find(argument arg)
 {
     const_iterator itr(&m_view);
@@ -169,6 +290,20 @@ std::size_t variant_associative_view::erase(argument key)
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+std::size_t variant_associative_view::erase(const variant_sequential_view& keys)
+{
+    std::size_t count = 0;
+    for (const auto& item : keys)
+    {
+        const variant key = item.get_type().is_wrapper() ? item.extract_wrapped_value() : item;
+        count += erase(key);
+    }
+
+    return count;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 void variant_associative_view::clear()
 {
     m_view.clear();
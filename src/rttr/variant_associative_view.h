@@ -31,6 +31,7 @@
 #include "rttr/detail/base/core_prerequisites.h"
 #include "rttr/detail/misc/misc_type_traits.h"
 #include "rttr/variant.h"
+#include "rttr/variant_sequential_view.h"
 #include "rttr/detail/variant_associative_view/variant_associative_view_private.h"
 
 #include <cstddef>
@@ -196,6 +197,15 @@ class RTTR_API variant_associative_view
          */
         std::size_t get_size() const noexcept;
 
+        /*!
+         * \brief Prepares the associative container for at least \p size elements,
+         *        e.g. the buckets of an `std::unordered_map` are allocated in advance,
+         *        so that inserting many elements does not rehash the container repeatedly.
+         *
+         * \return `true`, when the container supports reserving memory (e.g. `std::unordered_map`), otherwise `false`.
+         */
+        bool reserve(std::size_t size);
+
         /*!
          * \brief Insert a key into the container.
          *
@@ -212,6 +222,63 @@ class RTTR_API variant_associative_view
          */
         std::pair<const_iterator, bool> insert(argument key, argument value);
 
+        /*!
+         * \brief Inserts all keys of the sequential container \p keys into a key-only container.
+         *
+         * When \p keys is \ref variant_sequential_view::is_contiguous() "contiguous" and its value type is the
+         * key type of this container, all keys are inserted directly, without creating a \ref variant for every key.
+         * The needed memory is \ref reserve() "reserved" in advance.
+         *
+         * \return The number of inserted keys.
+         */
+        std::size_t insert(const variant_sequential_view& keys);
+
+        /*!
+         * \brief Inserts all key-value pairs, which are stored in the two sequential containers \p keys and \p values,
+         *        into the container. The key at index `i` is inserted together with the value at index `i`.
+         *
+         * Example code:
+         * \code{.cpp}
+         *  std::unordered_map<int, double> map;
+         *  std::vector<int> keys       = { 1, 2, 3 };
+         *  std::vector<double> values  = { 1.5, 2.5, 3.5 };
+         *
+         *  variant var = std::ref(map);
+         *  variant var_keys = std::ref(keys);
+         *  variant var_values = std::ref(values);
+         *  auto view = var.create_associative_view();
+         *  view.insert(var_keys.create_sequential_view(), var_values.create_sequential_view()); // returns 3
+         * \endcode
+         *
+         * When both containers are \ref variant_sequential_view::is_contiguous() "contiguous" and their value types
+         * are the key and value type of this container, all pairs are inserted directly,
+         * without creating a \ref variant for every element.
+         * The needed memory is \ref reserve() "reserved" in advance.
+         *
+         * \remark When both containers do not have the same size, nothing is inserted.
+         *
+         * \return The number of inserted key-value pairs.
+         */
+        std::size_t insert(const variant_sequential_view& keys, const variant_sequential_view& values);
+
+        /*!
+         * \brief Inserts all elements of the associative container \p other into the container.
+         *
+         * When \p other refers to this container, its elements are copied first.
+         *
+         * \return The number of inserted elements.
+         */
+        std::size_t insert(const variant_associative_view& other);
+
+        /*!
+         * \brief Inserts the elements of the range [\p first, \p last) into the container.
+         *
+         * When the range belongs to this container, its elements are copied before the first one is inserted.
+         *
+         * \return The number of inserted elements.
+         */
+        std::size_t insert(const const_iterator& first, const const_iterator& last);
+
         /*!
          * \brief Finds an element with specific key \p key .
          *
@@ -226,6 +293,13 @@ class RTTR_API variant_associative_view
          */
         std::size_t erase(argument key);
 
+        /*!
+         * \brief Removes all elements with a key, which is stored in the sequential container \p keys.
+         *
+         * \return The number of elements removed.
+         */
+        std::size_t erase(const variant_sequential_view& keys);
+
         /*!
          * \brief Removes all elements from the container.
          *
@@ -424,7 +498,7 @@ class RTTR_API variant_associative_view
                 bool operator!=(const const_iterator& other) const;
 
             private:
-                const_iterator(const detail::variant_associative_view_private* view) noexcept;
+                explicit const_iterator(const detail::variant_associative_view_private* view) noexcept;
                 void swap(const_iterator& other);
 
                 friend class variant_associative_view;
@@ -27,10 +27,13 @@
 
 
 #include "rttr/variant_sequential_view.h"
+#include "rttr/detail/conversion/number_array_conversion.h"
 
 #include "rttr/argument.h"
 #include "rttr/instance.h"
 
+#include <vector>
+
 using namespace std;
 
 namespace rttr
@@ -143,6 +146,84 @@ bool variant_sequential_view::set_size(std::size_t size) const noexcept
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+bool variant_sequential_view::reserve(std::size_t size) const
+{
+    return m_view.reserve(size);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool variant_sequential_view::is_contiguous() const noexcept
+{
+    return (m_view.get_contiguous_data().m_stride > 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_sequential_view::contiguous_data variant_sequential_view::get_contiguous_data() const noexcept
+{
+    const auto data = m_view.get_contiguous_data();
+    if (data.m_stride > 0)
+        return contiguous_data(data, m_view.get_value_type());
+    else
+        return contiguous_data();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool variant_sequential_view::convert(const variant_sequential_view& target) const
+{
+    if (!is_valid() || !target.is_valid())
+        return false;
+
+    auto target_view = target.m_view;
+    const std::size_t size = m_view.get_size();
+    const auto converter = detail::get_number_array_converter(m_view.get_value_type(), target_view.get_value_type());
+    const auto source_data = m_view.get_contiguous_data();
+    const auto target_data = target_view.get_contiguous_data();
+
+    if (converter.m_check && source_data.m_stride > 0 && target_data.m_stride > 0)
+    {
+        if (target_data.m_is_read_only || !converter.m_check(source_data.m_data, size))
+            return false;
+
+        if (target_view.get_size() != size && !target_view.set_size(size))
+            return false;
+
+        // the storage has moved, when the target was resized
+        converter.m_convert(source_data.m_data, target_view.get_contiguous_data().m_data, size);
+        return true;
+    }
+
+    // all elements are converted first, so a failed conversion does not modify the target
+    const type value_type = target_view.get_value_type();
+    std::vector<variant> values;
+    values.reserve(size);
+    for (const auto& item : *this)
+    {
+        // the elements of 'std::vector<bool>' are returned by value, not as 'std::reference_wrapper'
+        variant value = item.get_type().is_wrapper() ? item.extract_wrapped_value() : item;
+        if (!value.convert(value_type))
+            return false;
+
+        values.push_back(std::move(value));
+    }
+
+    if (target_view.get_size() != size && !target_view.set_size(size))
+        return false;
+
+    for (std::size_t index = 0; index < size; ++index)
+    {
+        argument arg(values[index]);
+        if (!target_view.set_value(index, arg))
+            return false;
+    }
+
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 variant_sequential_view::const_iterator variant_sequential_view::insert(const const_iterator& pos, argument value)
 {
     const_iterator itr(&m_view);
@@ -154,6 +235,74 @@ variant_sequential_view::const_iterator variant_sequential_view::insert(const co
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+variant_sequential_view::const_iterator variant_sequential_view::insert(const const_iterator& pos, const variant_sequential_view& values)
+{
+    // the range insertion of the container must not read from the container itself
+    const auto data = values.m_view.get_contiguous_data();
+    if (data.m_stride > 0 && values.m_view.get_value_type() == m_view.get_value_type() &&
+        !m_view.shares_storage_with(values.m_view))
+    {
+        const_iterator itr(&m_view);
+        if (m_view.insert_range(pos.m_itr, data.m_data, data.m_size, itr.m_itr))
+            return itr;
+    }
+
+    return insert(pos, values.begin(), values.end());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_sequential_view::const_iterator variant_sequential_view::insert(const const_iterator& pos,
+                                                                        const const_iterator& first,
+                                                                        const const_iterator& last)
+{
+    // 'reserve' and every insertion can invalidate 'pos', therefore only its index is kept
+    std::size_t index = 0;
+    for (auto itr = begin(); itr != pos; ++itr)
+        ++index;
+
+    const auto get_value = [](const const_iterator& itr)
+    {
+        const variant value = *itr;
+        return (value.get_type().is_wrapper() ? value.extract_wrapped_value() : value);
+    };
+
+    // when the values are taken from this container, 'reserve' and every insertion can move them,
+    // so they are copied in advance
+    std::vector<variant> values;
+    std::size_t count = 0;
+    const bool copy_values = (first.m_view && m_view.shares_storage_with(*first.m_view));
+    for (auto itr = first; itr != last; ++itr, ++count)
+    {
+        if (copy_values)
+            values.push_back(get_value(itr));
+    }
+
+    m_view.reserve(m_view.get_size() + count);
+
+    const auto get_iterator = [this](std::size_t position)
+    {
+        auto itr = begin();
+        m_view.advance(itr.m_itr, static_cast<std::ptrdiff_t>(position));
+        return itr;
+    };
+
+    auto itr = get_iterator(index);
+    auto itr_src = first;
+    for (std::size_t value_index = 0; value_index < count; ++value_index)
+    {
+        itr = insert(itr, copy_values ? values[value_index] : get_value(itr_src++));
+        if (itr == end())
+            return itr;
+
+        ++itr;
+    }
+
+    return get_iterator(index);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 variant_sequential_view::const_iterator variant_sequential_view::erase(const const_iterator& pos)
 {
     const_iterator itr(&m_view);
@@ -165,6 +314,26 @@ variant_sequential_view::const_iterator variant_sequential_view::erase(const con
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+variant_sequential_view::const_iterator variant_sequential_view::erase(const const_iterator& first, const const_iterator& last)
+{
+    const_iterator itr(&m_view);
+    if (m_view.erase_range(first.m_itr, last.m_itr, itr.m_itr))
+        return itr;
+
+    // 'last' is invalidated by the first erase, so the elements are counted in advance
+    std::size_t count = 0;
+    for (auto itr_count = first; itr_count != last; ++itr_count)
+        ++count;
+
+    itr = first;
+    while (count-- > 0)
+        itr = erase(itr);
+
+    return itr;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 void variant_sequential_view::clear()
 {
     m_view.clear();
@@ -355,6 +524,73 @@ bool variant_sequential_view::const_iterator::operator!=(const const_iterator& o
     return !m_view->equal(m_itr, other.m_itr);
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_sequential_view::contiguous_data::contiguous_data() noexcept
+:   m_value_type(detail::get_invalid_type())
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_sequential_view::contiguous_data::contiguous_data(const detail::sequential_contiguous_data& data,
+                                                          const type& value_type) noexcept
+:   m_data(data),
+    m_value_type(value_type)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool variant_sequential_view::contiguous_data::is_valid() const noexcept
+{
+    return (m_data.m_stride > 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_sequential_view::contiguous_data::operator bool() const noexcept
+{
+    return is_valid();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void* variant_sequential_view::contiguous_data::get_data() const noexcept
+{
+    return m_data.m_data;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t variant_sequential_view::contiguous_data::get_size() const noexcept
+{
+    return m_data.m_size;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t variant_sequential_view::contiguous_data::get_stride() const noexcept
+{
+    return m_data.m_stride;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+type variant_sequential_view::contiguous_data::get_value_type() const noexcept
+{
+    return m_value_type;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool variant_sequential_view::contiguous_data::is_read_only() const noexcept
+{
+    return m_data.m_is_read_only;
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////
 
 } // end namespace rttr
@@ -36,6 +36,7 @@
 #include <cstddef>
 #include <vector>
 #include <memory>
+#include <span>
 
 namespace rttr
 {
@@ -60,7 +61,7 @@ namespace rttr
  * RTTR recognize whether a type is an sequential container or not with the help of the \ref sequential_container_mapper class template.
  * This call can access different container types via one common interface.
  * At the moment there exist specializations for following types:
- * `std::vector<T>`, `std::array<T, std::size_t>`, `std::list<T>`, `std::deque<T>`, `std::initializer_list<T>` and raw arrays
+ * `std::vector<T>`, `std::array<T, std::size_t>`, `std::list<T>`, `std::deque<T>`, `std::initializer_list<T>`, `std::span<T>` and raw arrays
  *
  * Copying and Assignment
  * ----------------------
@@ -96,6 +97,7 @@ class RTTR_API variant_sequential_view
 {
     public:
         class const_iterator;
+        class contiguous_data;
 
         /*!
          * \brief Constructs an invalid variant_sequential_view object.
@@ -224,6 +226,62 @@ class RTTR_API variant_sequential_view
          */
         bool set_size(std::size_t size) const noexcept;
 
+        /*!
+         * \brief Increases the capacity of the sequential container to at least \p size elements,
+         *        without changing its size. Use this before inserting many elements one by one.
+         *
+         * \return `true`, when the container supports reserving memory (e.g. `std::vector`), otherwise `false`.
+         *
+         * \see insert()
+         */
+        bool reserve(std::size_t size) const;
+
+        /*!
+         * \brief Returns `true` when the elements of the sequential container are stored contiguously in memory.
+         *        This is the case for `std::vector<T>` (except `std::vector<bool>`), `std::array<T, N>`,
+         *        `std::span<T>`, `std::initializer_list<T>` and raw arrays.
+         *
+         * \see get_contiguous_data()
+         */
+        bool is_contiguous() const noexcept;
+
+        /*!
+         * \brief Returns the element storage of a contiguous sequential container.
+         *        With this, all elements can be processed at once (e.g. with `memcpy`),
+         *        instead of accessing every element through a \ref variant.
+         *
+         * \remark When the container is not contiguous, an invalid \ref contiguous_data object is returned.
+         *         The returned data is only valid as long as the container is not modified.
+         *
+         * \see is_contiguous()
+         */
+        contiguous_data get_contiguous_data() const noexcept;
+
+        /*!
+         * \brief Converts all elements of this sequential container into the value type
+         *        of the sequential container \p target and stores them there.
+         *        A dynamic \p target is resized to the size of this container;
+         *        a static \p target must have the same size.
+         *
+         * When both value types are arithmetic (e.g. `int32_t` and `double`) and both containers are
+         * \ref is_contiguous() "contiguous", all elements are converted at once, directly in the storage of \p target.
+         * Otherwise every element is converted separately with \ref variant::convert(const type&).
+         * The same range checks are used in both cases.
+         *
+         * \code{.cpp}
+         *  std::vector<int32_t> int_vec = { 1, 2, 3 };
+         *  std::vector<double> double_vec;
+         *  variant var_src = std::ref(int_vec);
+         *  variant var_tgt = std::ref(double_vec);
+         *  var_src.create_sequential_view().convert(var_tgt.create_sequential_view()); // double_vec: 1.0, 2.0, 3.0
+         * \endcode
+         *
+         * \remark When the conversion of an element fails, \p target is not modified.
+         *
+         * \return `true`, when all elements could be converted, otherwise `false`.
+         */
+        bool convert(const variant_sequential_view& target) const;
+
         /*!
          * \brief Insert a value into the container.
          *
@@ -231,6 +289,32 @@ class RTTR_API variant_sequential_view
          */
         const_iterator insert(const const_iterator& pos, argument value);
 
+        /*!
+         * \brief Inserts all elements of the sequential container \p values before the position \p pos.
+         *
+         * When \p values is \ref is_contiguous() "contiguous" and has the same value type as this container,
+         * all elements are inserted with one call of the underlying container (e.g. `std::vector::insert(pos, first, last)`).
+         * Otherwise the elements are inserted one by one, after the needed memory was \ref reserve() "reserved".
+         *
+         * When \p values refers to this container (e.g. `view.insert(view.end(), view)`),
+         * its elements are copied first and then inserted one by one.
+         *
+         * \return An iterator to the first inserted element or \p pos when \p values is empty,
+         *         otherwise an invalid iterator, when the insertion was not possible.
+         */
+        const_iterator insert(const const_iterator& pos, const variant_sequential_view& values);
+
+        /*!
+         * \brief Inserts the elements of the range [\p first, \p last) before the position \p pos.
+         *        The values of the range have to be convertible to the value type of this container.
+         *
+         * When the range belongs to this container, its elements are copied before the first one is inserted.
+         *
+         * \return An iterator to the first inserted element or \p pos when the range is empty,
+         *         otherwise an invalid iterator, when the insertion of an element was not possible.
+         */
+        const_iterator insert(const const_iterator& pos, const const_iterator& first, const const_iterator& last);
+
         /*!
          * \brief Removes the element (if one exists) at the position \p pos.
          *
@@ -238,6 +322,13 @@ class RTTR_API variant_sequential_view
          */
         const_iterator erase(const const_iterator& pos);
 
+        /*!
+         * \brief Removes the elements in the range [\p first, \p last).
+         *
+         * \return Iterator following the last removed element.
+         */
+        const_iterator erase(const const_iterator& first, const const_iterator& last);
+
         /*!
          * \brief Removes all elements from the container.
          *
@@ -411,7 +502,7 @@ class RTTR_API variant_sequential_view
                 bool operator!=(const const_iterator& other) const;
 
             private:
-                const_iterator(const detail::variant_sequential_view_private* view) noexcept;
+                explicit const_iterator(const detail::variant_sequential_view_private* view) noexcept;
                 void swap(const_iterator& other);
 
                 friend class variant_sequential_view;
@@ -419,6 +510,97 @@ class RTTR_API variant_sequential_view
                 const detail::variant_sequential_view_private* m_view;
                 detail::iterator_data m_itr;
         };
+
+        /*!
+         * The \ref variant_sequential_view::contiguous_data describes the element storage of a sequential container,
+         * whose elements are stored contiguously in memory.
+         * An instance can only be created by an variant_sequential_view.
+         *
+         * Typical Usage
+         * ----------------------
+         *
+         * \code{.cpp}
+         *  std::vector<float> my_vec = { 1.0f, 2.0f, 3.0f };
+         *  variant var = std::ref(my_vec);
+         *  auto data = var.create_sequential_view().get_contiguous_data();
+         *  for (float& value : data.get_span<float>())
+         *      value *= 2.0f;
+         * \endcode
+         *
+         * \remark The data is valid as long as the underlying container is valid and not modified.
+         */
+        class RTTR_API contiguous_data
+        {
+            public:
+                /*!
+                 * \brief Constructs an invalid contiguous_data object.
+                 */
+                contiguous_data() noexcept;
+
+                /*!
+                 * \brief Returns true if this object describes the element storage of a contiguous container.
+                 *        Remark that an empty container is also contiguous, but might not return any data address.
+                 */
+                bool is_valid() const noexcept;
+
+                /*!
+                 * \brief Convenience function to check if this \ref contiguous_data is valid or not.
+                 *
+                 * \see is_valid()
+                 */
+                explicit operator bool() const noexcept;
+
+                /*!
+                 * \brief Returns the address of the first element.
+                 *
+                 * \remark When the data \ref is_read_only "is read only", the elements must not be modified.
+                 */
+                void* get_data() const noexcept;
+
+                /*!
+                 * \brief Returns the number of elements.
+                 */
+                std::size_t get_size() const noexcept;
+
+                /*!
+                 * \brief Returns the distance in bytes between two elements.
+                 */
+                std::size_t get_stride() const noexcept;
+
+                /*!
+                 * \brief Returns the \ref type of the elements.
+                 */
+                type get_value_type() const noexcept;
+
+                /*!
+                 * \brief Returns `true`, when the elements cannot be modified; e.g. for a const container.
+                 */
+                bool is_read_only() const noexcept;
+
+                /*!
+                 * \brief Returns the elements as typed span.
+                 *
+                 * \remark When \p T is not the \ref get_value_type() "value type" of the elements,
+                 *         or the elements are \ref is_read_only() "read only" and \p T is not const,
+                 *         an empty span is returned.
+                 */
+                template<typename T>
+                std::span<T> get_span() const noexcept
+                {
+                    if (m_value_type != type::get<detail::remove_cv_t<T>>() || (m_data.m_is_read_only && !std::is_const<T>::value))
+                        return std::span<T>();
+
+                    return std::span<T>(static_cast<T*>(m_data.m_data), m_data.m_size);
+                }
+
+            private:
+                contiguous_data(const detail::sequential_contiguous_data& data, const type& value_type) noexcept;
+
+                friend class variant_sequential_view;
+
+                detail::sequential_contiguous_data m_data;
+                type m_value_type;
+        };
     private:
         friend class variant;
         friend class argument;
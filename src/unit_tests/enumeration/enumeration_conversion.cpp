@@ -33,6 +33,8 @@ using namespace std;
 #include <iostream>
 #include <memory>
 #include <functional>
+#include <cstdint>
+#include <limits>
 
 #include <catch2/catch_all.hpp>
 
@@ -43,6 +45,20 @@ enum class access_t : int
     exec = 4
 };
 
+enum class sparse_enum : int
+{
+    negative    = -1000,
+    zero        = 0,
+    alias_zero  = 0,
+    large       = 1 << 30
+};
+
+enum class wide_enum : std::uint64_t
+{
+    low     = 1,
+    high    = std::numeric_limits<std::uint64_t>::max()
+};
+
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
@@ -54,6 +70,20 @@ RTTR_REGISTRATION
         value("write",  access_t::write),
         value("exec",   access_t::exec)
     );
+
+    registration::enumeration<sparse_enum>("sparse_enum")
+    (
+        value("negative",   sparse_enum::negative),
+        value("zero",       sparse_enum::zero),
+        value("alias_zero", sparse_enum::alias_zero),
+        value("large",      sparse_enum::large)
+    );
+
+    registration::enumeration<wide_enum>("wide_enum")
+    (
+        value("low",    wide_enum::low),
+        value("high",   wide_enum::high)
+    );
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -73,6 +103,8 @@ TEST_CASE("enumeration - value_to_name()", "[enumeration]")
     // invalid
     CHECK(e.value_to_name("test")             == "");
     CHECK(e.value_to_name(42)                 == "");
+    CHECK(e.value_to_name(3)                  == "");
+    CHECK(e.value_to_name(0)                  == "");
 
     // negative
     e = type::get_by_name("access_unknown").get_enumeration();
@@ -102,3 +134,41 @@ TEST_CASE("enumeration - name_to_value()", "[enumeration]")
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("enumeration - value_to_name() - sparse values", "[enumeration]")
+{
+    enumeration e = type::get<sparse_enum>().get_enumeration();
+    CHECK(e.value_to_name(sparse_enum::negative)    == "negative");
+    CHECK(e.value_to_name(sparse_enum::large)       == "large");
+
+    // the first registered name of a value wins
+    CHECK(e.value_to_name(sparse_enum::alias_zero)  == "zero");
+
+    // invalid
+    CHECK(e.value_to_name(1)                        == "");
+    CHECK(e.value_to_name(-1001)                    == "");
+
+    e = type::get<wide_enum>().get_enumeration();
+    CHECK(e.value_to_name(wide_enum::low)           == "low");
+    CHECK(e.value_to_name(wide_enum::high)          == "high");
+    CHECK(e.value_to_name(static_cast<wide_enum>(0)).empty() == true);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("enumeration - name_to_value() - sparse values", "[enumeration]")
+{
+    enumeration e = type::get<sparse_enum>().get_enumeration();
+    CHECK(e.name_to_value("negative").get_value<sparse_enum>()      == sparse_enum::negative);
+    CHECK(e.name_to_value("alias_zero").get_value<sparse_enum>()    == sparse_enum::zero);
+    CHECK(e.name_to_value("large").get_value<sparse_enum>()         == sparse_enum::large);
+
+    // invalid
+    CHECK(e.name_to_value("").is_valid()        == false);
+    CHECK(e.name_to_value("larger").is_valid()  == false);
+
+    e = type::get<wide_enum>().get_enumeration();
+    CHECK(e.name_to_value("high").get_value<wide_enum>() == wide_enum::high);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
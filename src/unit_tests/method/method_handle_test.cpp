@@ -0,0 +1,135 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <rttr/registration>
+#include <rttr/method_handle.h>
+#include <catch2/catch_all.hpp>
+
+#include <string>
+
+using namespace rttr;
+using namespace std;
+
+struct method_handle_test
+{
+    int add(int value) { m_value += value; return m_value; }
+    int get_value() const { return m_value; }
+    const std::string& get_name() const { return m_name; }
+    void set_name(const std::string& name, int value) { m_name = name; m_value = value; }
+    static int twice(int value) { return value * 2; }
+
+    int         m_value = 0;
+    std::string m_name;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_REGISTRATION
+{
+    registration::class_<method_handle_test>("method_handle_test")
+        .method("add", &method_handle_test::add)
+        .method("get_value", &method_handle_test::get_value)
+        .method("get_name", &method_handle_test::get_name)
+        .method("set_name", &method_handle_test::set_name)
+        .method("twice", &method_handle_test::twice)
+        .method("lambda", [](int value) { return value + 1; })
+        .method("func", std::function<int(method_handle_test&)>([](method_handle_test& obj) { return obj.m_value; }))
+        ;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("method_handle - invoke", "[method]")
+{
+    type t = type::get<method_handle_test>();
+    method_handle_test obj;
+
+    SECTION("member function")
+    {
+        method_handle<int(method_handle_test&, int)> handle(t.get_method("add"));
+        REQUIRE(handle.is_valid() == true);
+        CHECK(handle(obj, 23) == 23);
+        CHECK(handle(obj, 19) == 42);
+    }
+
+    SECTION("const member function")
+    {
+        obj.m_value = 12;
+        method_handle<int(const method_handle_test&)> handle(t.get_method("get_value"));
+        REQUIRE(static_cast<bool>(handle) == true);
+        CHECK(handle(obj) == 12);
+
+        method_handle<int(method_handle_test&)> mutable_handle(t.get_method("get_value"));
+        REQUIRE(mutable_handle.is_valid() == true);
+        CHECK(mutable_handle(obj) == 12);
+    }
+
+    SECTION("reference arguments and return value")
+    {
+        method_handle<void(method_handle_test&, const std::string&, int)> setter(t.get_method("set_name"));
+        method_handle<const std::string&(const method_handle_test&)> getter(t.get_method("get_name"));
+        REQUIRE(setter.is_valid() == true);
+        REQUIRE(getter.is_valid() == true);
+
+        setter(obj, "foo", 5);
+        CHECK(obj.m_value == 5);
+        CHECK(&getter(obj) == &obj.m_name);
+    }
+
+    SECTION("static function and function objects")
+    {
+        method_handle<int(int)> twice(t.get_method("twice"));
+        method_handle<int(int)> lambda(t.get_method("lambda"));
+        method_handle<int(method_handle_test&)> func(t.get_method("func"));
+        REQUIRE(twice.is_valid() == true);
+        REQUIRE(lambda.is_valid() == true);
+        REQUIRE(func.is_valid() == true);
+
+        obj.m_value = 3;
+        CHECK(twice(21) == 42);
+        CHECK(lambda(41) == 42);
+        CHECK(func(obj) == 3);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("method_handle - signature mismatch", "[method]")
+{
+    type t = type::get<method_handle_test>();
+
+    CHECK(method_handle<int(method_handle_test&, int)>().is_valid() == false);
+    CHECK(method_handle<int(method_handle_test&, int)>(t.get_method("does_not_exist")).is_valid() == false);
+    CHECK(method_handle<int(method_handle_test&, double)>(t.get_method("add")).is_valid() == false);
+    CHECK(method_handle<long(method_handle_test&, int)>(t.get_method("add")).is_valid() == false);
+    CHECK(method_handle<int(int)>(t.get_method("add")).is_valid() == false);
+    CHECK(method_handle<int(const method_handle_test&, int)>(t.get_method("add")).is_valid() == false);
+    CHECK(method_handle<std::string(const method_handle_test&)>(t.get_method("get_name")).is_valid() == false);
+    CHECK(method_handle<int(method_handle_test&, int)>(t.get_method("twice")).is_valid() == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -47,6 +47,24 @@ struct method_invoke_test
     std::array<bool, 8> m_invoked;
 };
 
+struct method_invoke_overload_test
+{
+    int func(int) { return 1; }
+    int func(double) { return 2; }
+};
+
+struct method_invoke_late_base
+{
+    int late_func(int value) { return value * 2; }
+
+    RTTR_ENABLE()
+};
+
+struct method_invoke_late_derived : method_invoke_late_base
+{
+    RTTR_ENABLE(method_invoke_late_base)
+};
+
 
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -65,6 +83,11 @@ RTTR_REGISTRATION
         .method("func_8", std::function<int(int)>([](int value){ return value; }))
         .method("func_9", [](int value){ return value; })
         ;
+
+    registration::class_<method_invoke_overload_test>("method_invoke_overload_test")
+        .method("func", select_overload<int(int)>(&method_invoke_overload_test::func))
+        .method("func", select_overload<int(double)>(&method_invoke_overload_test::func))
+        ;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -192,3 +215,58 @@ TEST_CASE("method - invoke - lambda", "[method]")
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("method - invoke - repeated overload resolution", "[method]")
+{
+    type t = type::get<method_invoke_overload_test>();
+    method_invoke_overload_test obj;
+
+    // the resolution is cached after the first call; every call has to select the same overload
+    for (int i = 0; i < 3; ++i)
+    {
+        variant var = t.invoke("func", obj, {23});
+        REQUIRE(var.is_type<int>() == true);
+        CHECK(var.get_value<int>() == 1);
+
+        var = t.invoke("func", obj, {23.0});
+        REQUIRE(var.is_type<int>() == true);
+        CHECK(var.get_value<int>() == 2);
+
+        CHECK(t.invoke("func", obj, {std::string("text")}).is_valid() == false);
+        CHECK(t.invoke("func", obj, {23, 42}).is_valid() == false);
+    }
+
+    for (int i = 0; i < 3; ++i)
+    {
+        CHECK(t.get_method("func", {type::get<int>()}).invoke(obj, 23).get_value<int>() == 1);
+        CHECK(t.get_method("func", {type::get<double>()}).invoke(obj, 23.0).get_value<int>() == 2);
+        CHECK(t.get_method("func", {type::get<float>()}).is_valid() == false);
+        CHECK(t.get_method("func", {}).is_valid() == false);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("method - invoke - method registered after a failed resolution", "[method]")
+{
+    type t = type::get<method_invoke_late_derived>();
+    method_invoke_late_derived obj;
+
+    CHECK(t.get_method("late_func", {type::get<int>()}).is_valid() == false);
+    CHECK(t.invoke("late_func", obj, {23}).is_valid() == false);
+
+    // e.g. a plugin registers the method later on
+    registration::class_<method_invoke_late_base>("method_invoke_late_base")
+        .method("late_func", &method_invoke_late_base::late_func)
+        ;
+
+    const method meth = t.get_method("late_func", {type::get<int>()});
+    REQUIRE(meth.is_valid() == true);
+    CHECK(meth.invoke(obj, 23).get_value<int>() == 46);
+
+    const variant var = t.invoke("late_func", obj, {23});
+    REQUIRE(var.is_type<int>() == true);
+    CHECK(var.get_value<int>() == 46);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -217,6 +217,27 @@ TEST_CASE("method - default func - get_metadata()", "[method]")
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+TEST_CASE("method - get_metadata<T>()", "[method]")
+{
+    method meth = type::get_by_name("method_misc_test").get_method("func");
+    const bool* flag = meth.get_metadata<bool>(E_MetaData::SCRIPTABLE);
+    REQUIRE(flag != nullptr);
+    CHECK(*flag == true);
+
+    const std::string* text = meth.get_metadata<std::string>("Text");
+    REQUIRE(text != nullptr);
+    CHECK(*text == "Some funky description");
+
+    // negative
+    CHECK(meth.get_metadata<int>(E_MetaData::SCRIPTABLE) == nullptr);
+    CHECK(meth.get_metadata<bool>(E_MetaData::TOOL_TIP) == nullptr);
+
+    meth = type::get_by_name("method_misc_test").get_method("");
+    CHECK(meth.get_metadata<bool>(E_MetaData::SCRIPTABLE) == nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 TEST_CASE("method - NEGATIVE - get_metadata()", "[method]")
 {
     method meth = type::get_by_name("method_misc_test").get_method("func");
@@ -0,0 +1,157 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <rttr/registration>
+#include <rttr/name_key.h>
+
+#include <string>
+
+#include <catch2/catch_all.hpp>
+
+using namespace rttr;
+using namespace rttr::literals;
+
+struct name_key_base
+{
+    int base_value = 1;
+    int get_base() const { return base_value; }
+
+    RTTR_ENABLE()
+};
+
+struct name_key_derived : name_key_base
+{
+    int value = 2;
+    int get_value() const { return value; }
+    int get_base() const { return 42; }
+
+    RTTR_ENABLE(name_key_base)
+};
+
+enum class name_key_enum
+{
+    first,
+    second,
+    third
+};
+
+RTTR_REGISTRATION
+{
+    registration::class_<name_key_base>("name_key_base")
+        .property("base_value", &name_key_base::base_value)
+        .method("get_base", &name_key_base::get_base)
+        ;
+
+    registration::class_<name_key_derived>("name_key_derived")
+        .property("value", &name_key_derived::value)
+        .method("get_value", &name_key_derived::get_value)
+        .method("get_base", &name_key_derived::get_base)
+        ;
+
+    registration::enumeration<name_key_enum>("name_key_enum")
+        (
+            value("first",  name_key_enum::first),
+            value("second", name_key_enum::second),
+            value("third",  name_key_enum::third)
+        );
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("name_key - hash is computed at compile time", "[name_key]")
+{
+    constexpr name_key key("value");
+    static_assert(key.get_hash() == "value"_key.get_hash(), "both keys have to be equal");
+    static_assert(key.get_name().length() == 5, "the name has to be kept");
+
+    const std::string dynamic_name = "value";
+    const name_key dynamic_key(dynamic_name);
+    CHECK(dynamic_key.get_hash() == key.get_hash());
+    CHECK(dynamic_key.get_name() == "value");
+
+    CHECK(name_key("value").get_hash() != name_key("values").get_hash());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("name_key - type::get_property(const name_key&)", "[name_key]")
+{
+    const type t = type::get<name_key_derived>();
+
+    CHECK(t.get_property("value"_key) == t.get_property("value"));
+    CHECK(t.get_property("base_value"_key) == t.get_property("base_value"));
+    CHECK(t.get_property("base_value"_key).is_valid() == true);
+    CHECK(t.get_property("unknown"_key).is_valid() == false);
+    CHECK(type::get<name_key_base>().get_property("value"_key).is_valid() == false);
+
+    const std::string name = "value";
+    CHECK(t.get_property(name_key(name)).get_name() == "value");
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("name_key - type::get_method(const name_key&)", "[name_key]")
+{
+    const type t = type::get<name_key_derived>();
+
+    CHECK(t.get_method("get_value"_key) == t.get_method("get_value"));
+    CHECK(t.get_method("unknown"_key).is_valid() == false);
+
+    // the most-derived method has to be returned, like for a lookup with a string
+    const method meth = t.get_method("get_base"_key);
+    REQUIRE(meth.is_valid() == true);
+    CHECK(meth.get_declaring_type() == t);
+
+    name_key_derived obj;
+    CHECK(meth.invoke(obj).get_value<int>() == 42);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("name_key - type::get_by_name(const name_key&)", "[name_key]")
+{
+    CHECK(type::get_by_name("name_key_derived"_key) == type::get<name_key_derived>());
+    CHECK(type::get_by_name("name_key_enum"_key) == type::get<name_key_enum>());
+    CHECK(type::get_by_name("int"_key) == type::get<int>());
+    CHECK(type::get_by_name("unknown_type"_key).is_valid() == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("name_key - enumeration::name_to_value(const name_key&)", "[name_key]")
+{
+    const enumeration e = type::get<name_key_enum>().get_enumeration();
+
+    CHECK(e.name_to_value("first"_key).get_value<name_key_enum>() == name_key_enum::first);
+    CHECK(e.name_to_value("third"_key).get_value<name_key_enum>() == name_key_enum::third);
+    CHECK(e.name_to_value("fourth"_key).is_valid() == false);
+
+    const std::string name = "second";
+    CHECK(e.name_to_value(name_key(name)).get_value<name_key_enum>() == name_key_enum::second);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,225 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <rttr/registration>
+#include <rttr/library.h>
+#include <rttr/name_key.h>
+
+#include <string>
+
+#include <catch2/catch_all.hpp>
+
+using namespace rttr;
+using namespace rttr::literals;
+
+struct freeze_base
+{
+    int base_value = 1;
+    int get_id() const { return 1; }
+
+    RTTR_ENABLE()
+};
+
+struct freeze_derived : freeze_base
+{
+    int value = 2;
+    int get_id() const { return 2; }
+
+    RTTR_ENABLE(freeze_base)
+};
+
+struct freeze_target
+{
+    int value = 0;
+};
+
+struct freeze_late
+{
+    int value = 3;
+};
+
+static freeze_target convert_to_freeze_target(const freeze_derived& obj, bool& ok)
+{
+    ok = true;
+    return freeze_target{obj.value};
+}
+
+RTTR_REGISTRATION
+{
+    registration::class_<freeze_base>("freeze_base")
+        .property("base_value", &freeze_base::base_value)
+        .method("get_id", &freeze_base::get_id)
+        ;
+
+    registration::class_<freeze_derived>("freeze_derived")
+        .property("value", &freeze_derived::value)
+        .method("get_id", &freeze_derived::get_id)
+        ;
+
+    type::register_converter_func(convert_to_freeze_target);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static void register_freeze_late()
+{
+    registration::class_<freeze_late>("freeze_late")
+        .property("value", &freeze_late::value)
+        ;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static std::size_t g_rejection_count = 0;
+static std::string g_rejected_item;
+
+static void on_rejected_registration(const type&, string_view item)
+{
+    ++g_rejection_count;
+    g_rejected_item = item.to_string();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static library get_test_plugin()
+{
+#ifdef NDEBUG
+    return library("unit_test_plugin");
+#else
+    return library("unit_test_plugin_d");
+#endif
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("registration - freeze", "[registration]")
+{
+    REQUIRE(registration::freeze() == true);
+    CHECK(registration::is_frozen() == true);
+    // a second call does nothing
+    CHECK(registration::freeze() == true);
+
+    SECTION("get_by_name")
+    {
+        CHECK(type::get_by_name("freeze_derived") == type::get<freeze_derived>());
+        CHECK(type::get_by_name("freeze_derived"_key) == type::get<freeze_derived>());
+        CHECK(type::get_by_name("int") == type::get<int>());
+        CHECK(type::get_by_name("freeze_unknown").is_valid() == false);
+        CHECK(type::get_by_name("freeze_unknown"_key).is_valid() == false);
+    }
+
+    SECTION("member by name")
+    {
+        const type t = type::get<freeze_derived>();
+
+        CHECK(t.get_property("value").get_declaring_type() == t);
+        CHECK(t.get_property("base_value"_key).get_declaring_type() == type::get<freeze_base>());
+        CHECK(t.get_property("unknown").is_valid() == false);
+
+        // the most-derived method is found
+        const method meth = t.get_method("get_id");
+        REQUIRE(meth.is_valid() == true);
+        freeze_derived obj;
+        CHECK(meth.invoke(obj).get_value<int>() == 2);
+        CHECK(t.get_method("get_id"_key) == meth);
+        CHECK(t.get_method("unknown"_key).is_valid() == false);
+
+        CHECK(type::get<freeze_base>().get_method("get_id").invoke(obj).get_value<int>() == 1);
+    }
+
+    SECTION("converter")
+    {
+        variant var = freeze_derived();
+        CHECK(var.can_convert<freeze_target>() == true);
+        bool ok = false;
+        CHECK(var.convert<freeze_target>(&ok).value == 2);
+        CHECK(ok == true);
+
+        CHECK(var.can_convert<freeze_late>() == false);
+    }
+
+    SECTION("registration is rejected")
+    {
+        const auto rejected_count = registration::get_rejected_count();
+        register_freeze_late();
+
+        // the type itself is still known, because a type is registered implicitly
+        const type t = type::get<freeze_late>();
+        CHECK(t.is_valid() == true);
+        CHECK(type::get_by_name(t.get_name()) == t);
+
+        CHECK(t.get_property("value").is_valid() == false);
+        CHECK(registration::get_rejected_count() > rejected_count);
+    }
+
+    SECTION("rejection callback")
+    {
+        g_rejection_count = 0;
+        registration::set_rejection_callback(&on_rejected_registration);
+        register_freeze_late();
+        registration::set_rejection_callback(nullptr);
+
+        CHECK(g_rejection_count > 0);
+        CHECK(g_rejected_item == "value");
+    }
+
+    SECTION("unload a library, which was loaded after the freeze")
+    {
+        auto lib = get_test_plugin();
+        REQUIRE(lib.load() == true);
+        CHECK(lib.unload() == true);
+
+        // the library could not register anything, so its unloading removes nothing of the frozen registry
+        CHECK(registration::is_frozen() == true);
+        CHECK(type::get_by_name("freeze_derived") == type::get<freeze_derived>());
+    }
+
+    registration::thaw();
+    CHECK(registration::is_frozen() == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("registration - thaw", "[registration]")
+{
+    registration::thaw();
+    REQUIRE(registration::freeze() == true);
+    registration::thaw();
+    CHECK(registration::is_frozen() == false);
+
+    // a registration is accepted again
+    const auto rejected_count = registration::get_rejected_count();
+    register_freeze_late();
+    CHECK(registration::get_rejected_count() == rejected_count);
+    CHECK(type::get<freeze_late>().get_property("value").is_valid() == true);
+
+    REQUIRE(registration::freeze() == true);
+    CHECK(type::get<freeze_late>().get_property("value").is_valid() == true);
+    registration::thaw();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,167 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <rttr/registration>
+#include <rttr/property_accessor.h>
+#include <catch2/catch_all.hpp>
+
+#include <string>
+
+using namespace rttr;
+using namespace std;
+
+struct property_accessor_test
+{
+    int get_func_value() const { return m_func_value; }
+    void set_func_value(int value) { m_func_value = value; }
+    const std::string& get_text() const { return m_text; }
+    void set_text(const std::string& text) { m_text = text; }
+    int get_non_const_value() { return m_value; }
+
+    int         m_value = 0;
+    int         m_readonly_value = 7;
+    double      m_ptr_value = 0.0;
+    int         m_func_value = 0;
+    std::string m_text;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_REGISTRATION
+{
+    registration::class_<property_accessor_test>("property_accessor_test")
+        .property("value", &property_accessor_test::m_value)
+        .property_readonly("readonly_value", &property_accessor_test::m_readonly_value)
+        .property("ptr_value", &property_accessor_test::m_ptr_value)
+        (
+            policy::prop::bind_as_ptr
+        )
+        .property("func_value", &property_accessor_test::get_func_value, &property_accessor_test::set_func_value)
+        .property_readonly("readonly_func_value", &property_accessor_test::get_func_value)
+        .property("text", &property_accessor_test::get_text, &property_accessor_test::set_text)
+        .property_readonly("non_const_func_value", &property_accessor_test::get_non_const_value)
+        ;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("property_accessor - member object", "[property]")
+{
+    type t = type::get<property_accessor_test>();
+    property_accessor_test obj;
+
+    SECTION("read write")
+    {
+        property_accessor<property_accessor_test, int> acc(t.get_property("value"));
+        REQUIRE(acc.is_valid() == true);
+        CHECK(acc.is_readonly() == false);
+        CHECK(acc.has_ref() == true);
+
+        CHECK(acc.set(obj, 23) == true);
+        CHECK(obj.m_value == 23);
+        CHECK(acc.get(obj) == 23);
+
+        acc.get_ref(obj) = 42;
+        CHECK(obj.m_value == 42);
+        CHECK(&acc.get_ref(static_cast<const property_accessor_test&>(obj)) == &obj.m_value);
+    }
+
+    SECTION("read only")
+    {
+        property_accessor<property_accessor_test, int> readonly_acc(t.get_property("readonly_value"));
+        REQUIRE(readonly_acc.is_valid() == true);
+        CHECK(readonly_acc.is_readonly() == true);
+        CHECK(readonly_acc.has_ref() == false);
+        CHECK(readonly_acc.get(obj) == 7);
+
+        // the value is read through the member pointer, but never written
+        CHECK(readonly_acc.set(obj, 23) == false);
+        CHECK(obj.m_readonly_value == 7);
+    }
+
+    SECTION("policy is not applied")
+    {
+        property_accessor<property_accessor_test, double> acc(t.get_property("ptr_value"));
+        REQUIRE(acc.is_valid() == true);
+        CHECK(acc.is_readonly() == false);
+
+        acc.set(obj, 2.5);
+        CHECK(obj.m_ptr_value == 2.5);
+        CHECK(acc.get(obj) == 2.5);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("property_accessor - getter and setter", "[property]")
+{
+    type t = type::get<property_accessor_test>();
+    property_accessor_test obj;
+
+    property_accessor<property_accessor_test, int> acc(t.get_property("func_value"));
+    REQUIRE(acc.is_valid() == true);
+    CHECK(acc.is_readonly() == false);
+    CHECK(acc.has_ref() == false);
+    acc.set(obj, 12);
+    CHECK(obj.m_func_value == 12);
+    CHECK(acc.get(obj) == 12);
+
+    property_accessor<property_accessor_test, int> readonly_acc(t.get_property("readonly_func_value"));
+    REQUIRE(readonly_acc.is_valid() == true);
+    CHECK(readonly_acc.is_readonly() == true);
+    CHECK(readonly_acc.get(obj) == 12);
+    CHECK(readonly_acc.set(obj, 5) == false);
+    CHECK(obj.m_func_value == 12);
+
+    // the accessor reads from a const object, this getter cannot be called with it
+    property_accessor<property_accessor_test, int> non_const_acc(t.get_property("non_const_func_value"));
+    CHECK(non_const_acc.is_valid() == false);
+    CHECK(property_accessor<property_accessor_test, int>().set(obj, 5) == false);
+
+    property_accessor<property_accessor_test, std::string> text_acc(t.get_property("text"));
+    REQUIRE(text_acc.is_valid() == true);
+    CHECK(text_acc.is_readonly() == false);
+    text_acc.set(obj, "hello");
+    CHECK(obj.m_text == "hello");
+    CHECK(text_acc.get(obj) == "hello");
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("property_accessor - type mismatch", "[property]")
+{
+    type t = type::get<property_accessor_test>();
+
+    CHECK(property_accessor<property_accessor_test, int>().is_valid() == false);
+    CHECK(property_accessor<property_accessor_test, int>(t.get_property("does_not_exist")).is_valid() == false);
+    CHECK(property_accessor<property_accessor_test, double>(t.get_property("value")).is_valid() == false);
+    CHECK(property_accessor<property_accessor_test, long>(t.get_property("func_value")).is_valid() == false);
+    CHECK(property_accessor<property_accessor_test, int>(t.get_property("text")).is_valid() == false);
+    CHECK(property_accessor<property_accessor_test, int>(type::get_global_property("does_not_exist")).is_valid() == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -215,6 +215,23 @@ TEST_CASE("property - get_properties()", "[property]")
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+TEST_CASE("property - get_properties(filter_items) - cached result", "[property]")
+{
+    type t = type::get<ns_property::bottom>();
+    const auto filter = filter_item::instance_item | filter_item::non_public_access | filter_item::declared_only;
+
+    auto range_1 = t.get_properties(filter);
+    auto range_2 = t.get_properties(filter);
+    REQUIRE(range_1.size() == 2);
+    CHECK(range_1.begin()->get_name() == "bottom-private");
+
+    // the matching properties are stored only once per filter combination
+    CHECK(&(*range_1.begin()) == &(*range_2.begin()));
+    CHECK(&(*t.get_properties().begin()) != &(*range_1.begin()));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 TEST_CASE("property - class - query", "[property]")
 {
     type t = type::get<ns_property::bottom>();
@@ -213,6 +213,25 @@ TEST_CASE("property - get_metadata()", "[property]")
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+TEST_CASE("property - get_metadata<T>()", "[property]")
+{
+    property prop = type::get<prop_misc_test>().get_property("value_1");
+    const std::string* text = prop.get_metadata<std::string>("Text");
+    REQUIRE(text != nullptr);
+    CHECK(*text == "This is some description text");
+
+    CHECK(prop.get_metadata<int>("Text") == nullptr);
+    CHECK(prop.get_metadata<std::string>("Invalid Key") == nullptr);
+
+    prop = type::get<prop_misc_test>().get_property("value_2");
+    CHECK(prop.get_metadata<std::string>("Text") == nullptr);
+
+    prop = type::get<prop_misc_test>().get_property("");
+    CHECK(prop.get_metadata<std::string>("Text") == nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 TEST_CASE("property - compare operators()", "[property]")
 {
     property prop1  = type::get<prop_misc_test>().get_property("value_1");
@@ -68,7 +68,10 @@ RTTR_REGISTRATION
                 metadata(key_data, "foo"),
                 metadata("other_key", "bar"),
                 metadata("bar", 42),
-                metadata("foobar", "hello")
+                metadata("foobar", "hello"),
+                metadata(23, "int key"),
+                metadata(5.0, "double key"),
+                metadata("7", "string key")
             );
 }
 
@@ -275,6 +278,28 @@ TEST_CASE("Test rttr::type - Virtual Inheritance", "[type]")
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+TEST_CASE("Test rttr::type - rttr_cast address", "[type]")
+{
+    FinalClass final;
+    ClassMultipleBaseC& base_c = final;
+    ClassMultiple4E& middle_e = final;
+
+    // up cast
+    CHECK(rttr_cast<ClassMultipleBaseC*>(&final) == &base_c);
+    CHECK(rttr_cast<ClassMultipleBaseE*>(&middle_e) == static_cast<ClassMultipleBaseE*>(&final));
+
+    // down cast and cross cast
+    CHECK(rttr_cast<FinalClass*>(&base_c) == &final);
+    CHECK(rttr_cast<ClassMultiple4E*>(&base_c) == &middle_e);
+
+    DiamondBottom diamond;
+    DiamondTop* top = &diamond;
+    CHECK(rttr_cast<DiamondTop*>(static_cast<DiamondLeft*>(&diamond)) == top);
+    CHECK(rttr_cast<DiamondRight*>(top) == static_cast<DiamondRight*>(&diamond));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 TEST_CASE("type - get_base_classes()", "[type]")
 {
     DiamondBottom d;
@@ -636,5 +661,83 @@ TEST_CASE("Test rttr::type - get_metadata()", "[type]")
     CHECK(t.get_metadata("novalid key").is_valid() == false);
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("Test rttr::type - get_metadata() - integral keys", "[type]")
+{
+    auto t = type::get<type_metadata_test>();
+
+    CHECK(t.get_metadata(23) == "int key");
+    CHECK(t.get_metadata(static_cast<uint8_t>(23)) == "int key");
+    CHECK(t.get_metadata(23.0) == "int key");
+
+    // negative
+    CHECK(t.get_metadata(24).is_valid() == false);
+    CHECK(t.get_metadata(-23).is_valid() == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("Test rttr::type - get_metadata<T>()", "[type]")
+{
+    auto t = type::get<type_metadata_test>();
+
+    const int* int_value = t.get_metadata<int>("bar");
+    REQUIRE(int_value != nullptr);
+    CHECK(*int_value == 42);
+
+    const std::string* text = t.get_metadata<std::string>(std::string("other_key"));
+    REQUIRE(text != nullptr);
+    CHECK(*text == "bar");
+
+    text = t.get_metadata<std::string>(string_view("foobar"));
+    REQUIRE(text != nullptr);
+    CHECK(*text == "hello");
+
+    text = t.get_metadata<std::string>(23);
+    REQUIRE(text != nullptr);
+    CHECK(*text == "int key");
+
+    text = t.get_metadata<std::string>(variant(key_data));
+    REQUIRE(text != nullptr);
+    CHECK(*text == "foo");
+
+    // the value is returned by reference
+    CHECK(t.get_metadata<int>("bar") == int_value);
+
+    // negative
+    CHECK(t.get_metadata<double>("bar") == nullptr);
+    CHECK(t.get_metadata<int>("novalid key") == nullptr);
+    CHECK(type::get<int>().get_metadata<int>("bar") == nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("Test rttr::type - get_metadata<T>() - keys of different types", "[type]")
+{
+    auto t = type::get<type_metadata_test>();
+
+    // the typed lookup finds the same metadata as the lookup with a variant
+    CHECK(t.get_metadata(5) == "double key");
+    const std::string* text = t.get_metadata<std::string>(5);
+    REQUIRE(text != nullptr);
+    CHECK(*text == "double key");
+
+    CHECK(t.get_metadata(7) == "string key");
+    text = t.get_metadata<std::string>(7);
+    REQUIRE(text != nullptr);
+    CHECK(*text == "string key");
+
+    CHECK(t.get_metadata(std::string("23")) == "int key");
+    text = t.get_metadata<std::string>("23");
+    REQUIRE(text != nullptr);
+    CHECK(*text == "int key");
+
+    // negative
+    CHECK(t.get_metadata(6).is_valid() == false);
+    CHECK(t.get_metadata<std::string>(6) == nullptr);
+    CHECK(t.get_metadata<std::string>("24") == nullptr);
+}
+
 
 /////////////////////////////////////////////////////////////////////////////////////////
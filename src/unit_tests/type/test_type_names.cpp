@@ -29,6 +29,10 @@
 #include <catch2/catch_all.hpp>
 #include <rttr/type>
 
+#include <atomic>
+#include <thread>
+#include <utility>
+
 using namespace rttr;
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -55,3 +59,66 @@ TEST_CASE("Test rttr::type - type::get_by_name", "[type]")
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+
+template<std::size_t... I>
+static std::vector<type> register_char_array_types(std::index_sequence<I...>)
+{
+    return { type::get<char[I + 1]>()... };
+}
+
+TEST_CASE("Test rttr::type - type::get_by_name - concurrent registration", "[type]")
+{
+    std::atomic<bool> stop(false);
+    std::atomic<int> failed_lookups(0);
+
+    std::thread reader([&]()
+    {
+        while (!stop)
+        {
+            if (!type::get_by_name("std::string").is_valid())
+                ++failed_lookups;
+        }
+    });
+
+    const auto new_types = register_char_array_types(std::make_index_sequence<64>());
+    stop = true;
+    reader.join();
+
+    CHECK(failed_lookups == 0);
+    for (const auto& t : new_types)
+        CHECK(type::get_by_name(t.get_name()) == t);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<std::size_t... I>
+static std::vector<type> register_short_array_types(std::index_sequence<I...>)
+{
+    return { type::get<short[I + 1]>()... };
+}
+
+TEST_CASE("Test rttr::type - type::get_types - register while iterating", "[type]")
+{
+    const auto range = type::get_types();
+    const std::vector<type> types_before(range.cbegin(), range.cend());
+
+    std::vector<type> new_types;
+    std::size_t index = 0;
+    for (const auto& t : range)
+    {
+        // the types are registered implicitly, while the range is still used
+        if (index == 0)
+            new_types = register_short_array_types(std::make_index_sequence<256>());
+
+        REQUIRE(index < types_before.size());
+        CHECK(t == types_before[index]);
+        ++index;
+    }
+
+    CHECK(index == types_before.size());
+    CHECK(type::get_types().size() == types_before.size() + new_types.size());
+    for (const auto& t : new_types)
+        CHECK(type::get_by_name(t.get_name()) == t);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
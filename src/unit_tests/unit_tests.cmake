@@ -40,6 +40,8 @@ set(SOURCE_FILES main.cpp
                  misc/string_view_test.cpp
                  misc/enum_flags_test.cpp
                  misc/library_test.cpp
+                 misc/name_key_test.cpp
+                 misc/registry_freeze_test.cpp
                  property/property_access_level_test.cpp
                  property/property_misc_test.cpp
                  property/property_class_inheritance.cpp
@@ -49,6 +51,7 @@ set(SOURCE_FILES main.cpp
                  property/property_order_test.cpp
                  property/property_global_function.cpp
                  property/property_global_object.cpp
+                 property/property_accessor_test.cpp
                  type/test_type.cpp
                  type/test_type_names.cpp
                  type/type_prop_meth_invoke.cpp
@@ -70,6 +73,7 @@ set(SOURCE_FILES main.cpp
                  method/method_default_arg_test.cpp
                  method/method_misc_test.cpp
                  method/method_invoke_test.cpp
+                 method/method_handle_test.cpp
                  method/method_order_test.cpp
                  method/method_param_info_test.cpp
                  method/method_query_test.cpp
@@ -82,6 +86,7 @@ set(SOURCE_FILES main.cpp
                  variant/variant_cmp_less_or_equal.cpp
                  variant/variant_cmp_greater_or_equal.cpp
                  variant/variant_misc_test.cpp
+                 variant/variant_allocator_test.cpp
                  variant/variant_cast_test.cpp
                  variant/variant_conv_to_bool.cpp
                  variant/variant_conv_to_int8.cpp
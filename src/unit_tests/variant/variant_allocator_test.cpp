@@ -0,0 +1,132 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <catch2/catch_all.hpp>
+#include <rttr/type>
+
+#include <array>
+#include <string>
+#include <thread>
+
+using namespace rttr;
+using namespace std;
+
+static std::size_t g_custom_allocations = 0;
+static std::size_t g_custom_deallocations = 0;
+
+static void* custom_allocate(std::size_t size, std::size_t alignment)
+{
+    ++g_custom_allocations;
+    return ::operator new(size, std::align_val_t(alignment));
+}
+
+static void custom_deallocate(void* ptr, std::size_t, std::size_t alignment) noexcept
+{
+    ++g_custom_deallocations;
+    ::operator delete(ptr, std::align_val_t(alignment));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant_allocator - stats", "[variant]")
+{
+    reset_variant_allocator_stats();
+
+    SECTION("small types are placed inline")
+    {
+        variant var = 42;
+        variant var_2 = var;
+
+        CHECK(get_variant_allocator_stats().allocations == 0);
+    }
+
+    SECTION("big types are allocated")
+    {
+        {
+            variant var = std::array<double, 16>{};
+            variant var_2 = var;
+
+            CHECK(get_variant_allocator_stats().allocations == 2);
+            CHECK(get_variant_allocator_stats().deallocations == 0);
+        }
+
+        CHECK(get_variant_allocator_stats().deallocations == 2);
+    }
+
+    SECTION("freed blocks are reused")
+    {
+        { variant var = std::array<double, 16>{}; }
+        { variant var = std::array<double, 16>{}; }
+
+        CHECK(get_variant_allocator_stats().allocations == 2);
+        CHECK(get_variant_allocator_stats().pool_hits >= 1);
+    }
+
+    SECTION("allocations of other threads are counted")
+    {
+        std::thread worker([]()
+        {
+            variant var = std::array<double, 16>{};
+            variant var_2 = var;
+        });
+        worker.join();
+
+        // the counters of the finished thread are still part of the stats
+        CHECK(get_variant_allocator_stats().allocations == 2);
+        CHECK(get_variant_allocator_stats().deallocations == 2);
+
+        reset_variant_allocator_stats();
+        CHECK(get_variant_allocator_stats().allocations == 0);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant_allocator - custom allocator", "[variant]")
+{
+    g_custom_allocations = 0;
+    g_custom_deallocations = 0;
+
+    set_variant_allocator({&custom_allocate, &custom_deallocate});
+    {
+        variant var = std::array<int, 64>{23};
+        variant var_2 = var;
+
+        CHECK(var_2.get_value<std::array<int, 64>>()[0] == 23);
+        CHECK(g_custom_allocations == 2);
+    }
+    CHECK(g_custom_deallocations == 2);
+
+    set_variant_allocator({nullptr, nullptr});
+
+    auto allocator = get_variant_allocator();
+    auto default_allocator = get_default_variant_allocator();
+    CHECK(allocator.allocate == default_allocator.allocate);
+    CHECK(allocator.deallocate == default_allocator.deallocate);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
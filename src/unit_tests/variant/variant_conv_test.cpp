@@ -305,7 +305,7 @@ TEST_CASE("variant conversion - to std::string", "[variant]")
         CHECK(var.to_string() == "1.567");
 
         var = 3.12345678f;
-        CHECK(var.to_string() == "3.12346");
+        CHECK(var.to_string() == "3.1234567");
 
         var = 0.0f;
         CHECK(var.to_string() == "0");
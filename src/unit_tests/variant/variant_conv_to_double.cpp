@@ -163,6 +163,42 @@ TEST_CASE("variant::to_double() - from std::string", "[variant]")
         CHECK(ok == false);
         CHECK(var.convert(type::get<double>()) == false);
     }
+
+    SECTION("white space and sign")
+    {
+        bool ok = false;
+        CHECK(variant(std::string(" \n-1.5e2")).to_double(&ok) == -150.0);
+        CHECK(ok == true);
+
+        ok = false;
+        CHECK(variant(std::string("+2.5")).to_double(&ok) == 2.5);
+        CHECK(ok == true);
+
+        for (const auto& text : {"2.5 ", "+-2.5", "--2.5", "-", ""})
+        {
+            ok = true;
+            CHECK(variant(std::string(text)).to_double(&ok) == 0.0);
+            CHECK(ok == false);
+        }
+    }
+
+    SECTION("hex")
+    {
+        bool ok = false;
+        CHECK(variant(std::string("0x1p3")).to_double(&ok) == 8.0);
+        CHECK(ok == true);
+
+        ok = false;
+        CHECK(variant(std::string("-0X10")).to_double(&ok) == -16.0);
+        CHECK(ok == true);
+
+        for (const auto& text : {"0x", "0x-1p3", "0xg"})
+        {
+            ok = true;
+            CHECK(variant(std::string(text)).to_double(&ok) == 0.0);
+            CHECK(ok == false);
+        }
+    }
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
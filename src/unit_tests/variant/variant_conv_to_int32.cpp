@@ -162,6 +162,37 @@ TEST_CASE("variant::to_int32() - from std::string", "[variant]")
         CHECK(ok == false);
         CHECK(var.convert(type::get<int32_t>()) == false);
     }
+
+    SECTION("white space and sign")
+    {
+        bool ok = false;
+        CHECK(variant(std::string(" \t42")).to_int32(&ok) == 42);
+        CHECK(ok == true);
+
+        ok = false;
+        CHECK(variant(std::string("+42")).to_int32(&ok) == 42);
+        CHECK(ok == true);
+
+        ok = false;
+        CHECK(variant(std::string("-2147483648")).to_int32(&ok) == std::numeric_limits<int32_t>::min());
+        CHECK(ok == true);
+
+        for (const auto& text : {"42 ", "+-42", "-+42", "--42", "+", "-", " ", ""})
+        {
+            ok = true;
+            CHECK(variant(std::string(text)).to_int32(&ok) == 0);
+            CHECK(ok == false);
+        }
+    }
+
+    SECTION("hex")
+    {
+        variant var = std::string("0x10");
+        bool ok = true;
+        CHECK(var.to_int32(&ok) == 0);
+        CHECK(ok == false);
+        CHECK(var.convert(type::get<int32_t>()) == false);
+    }
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
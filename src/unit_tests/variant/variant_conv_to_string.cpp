@@ -161,18 +161,18 @@ TEST_CASE("variant::to_string() - from float", "[variant]")
         variant var = 214748.9f;
         REQUIRE(var.can_convert<std::string>() == true);
         bool ok = false;
-        CHECK(var.to_string(&ok) == "214749");
+        CHECK(var.to_string(&ok) == "214748.9");
         CHECK(ok == true);
 
         REQUIRE(var.convert(type::get<std::string>()) == true);
-        CHECK(var.get_value<std::string>() == "214749");
+        CHECK(var.get_value<std::string>() == "214748.9");
     }
 
     SECTION("conversion negative")
     {
         variant var = -214748.9f;
         bool ok = false;
-        CHECK(var.to_string(&ok) == "-214749");
+        CHECK(var.to_string(&ok) == "-214748.9");
         CHECK(ok == true);
         CHECK(var.convert(type::get<std::string>()) == true);
     }
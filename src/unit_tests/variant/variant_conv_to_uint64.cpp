@@ -154,6 +154,33 @@ TEST_CASE("variant::to_uint64() - from std::string", "[variant]")
         CHECK(ok == false);
         CHECK(var.convert(type::get<uint64_t>()) == false);
     }
+
+    SECTION("white space and sign")
+    {
+        bool ok = false;
+        CHECK(variant(std::string("  42")).to_uint64(&ok) == 42);
+        CHECK(ok == true);
+
+        ok = false;
+        CHECK(variant(std::string("+42")).to_uint64(&ok) == 42);
+        CHECK(ok == true);
+
+        for (const auto& text : {"42 ", "-0", "+-42", "++42", "+", ""})
+        {
+            ok = true;
+            CHECK(variant(std::string(text)).to_uint64(&ok) == 0);
+            CHECK(ok == false);
+        }
+    }
+
+    SECTION("hex")
+    {
+        variant var = std::string("0x10");
+        bool ok = true;
+        CHECK(var.to_uint64(&ok) == 0);
+        CHECK(ok == false);
+        CHECK(var.convert(type::get<uint64_t>()) == false);
+    }
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -29,9 +29,14 @@
 
 #include <rttr/type>
 
+#include <deque>
+#include <list>
 #include <vector>
 #include <map>
+#include <set>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 
 using namespace rttr;
 using namespace std;
@@ -634,3 +639,202 @@ TEST_CASE("variant_associative_view::begin/end", "[variant_associative_view]")
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant_associative_view::reserve", "[variant_associative_view]")
+{
+    SECTION("std::unordered_map")
+    {
+        std::unordered_map<int, std::string> map;
+        variant var = std::ref(map);
+        auto view = var.create_associative_view();
+
+        CHECK(view.reserve(100) == true);
+        CHECK(map.bucket_count() * map.max_load_factor() >= 100);
+        CHECK(view.get_size() == 0);
+    }
+
+    SECTION("std::map")
+    {
+        std::map<int, std::string> map;
+        variant var = std::ref(map);
+        auto view = var.create_associative_view();
+
+        CHECK(view.reserve(100) == false);
+    }
+
+    SECTION("const std::unordered_set")
+    {
+        const std::unordered_set<int> set;
+        variant var = std::cref(set);
+        auto view = var.create_associative_view();
+
+        CHECK(view.reserve(100) == false);
+    }
+
+    SECTION("invalid")
+    {
+        variant var;
+        auto view = var.create_associative_view();
+
+        CHECK(view.reserve(100) == false);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant_associative_view::insert - batch", "[variant_associative_view]")
+{
+    SECTION("contiguous keys and values")
+    {
+        std::unordered_map<int, std::string> map;
+        std::vector<int> keys = { 1, 2, 3 };
+        std::vector<std::string> values = { "A", "B", "C" };
+        variant var = std::ref(map);
+        variant var_keys = std::ref(keys);
+        variant var_values = std::ref(values);
+        auto view = var.create_associative_view();
+
+        CHECK(view.insert(var_keys.create_sequential_view(), var_values.create_sequential_view()) == 3);
+        CHECK(map == std::unordered_map<int, std::string>({ { 1, "A" }, { 2, "B" }, { 3, "C" } }));
+
+        // keys already exist
+        CHECK(view.insert(var_keys.create_sequential_view(), var_values.create_sequential_view()) == 0);
+        CHECK(view.get_size() == 3);
+    }
+
+    SECTION("non-contiguous keys and values")
+    {
+        std::map<int, std::string> map = { { 1, "A" } };
+        std::list<int> keys = { 1, 2, 3 };
+        std::deque<std::string> values = { "X", "B", "C" };
+        variant var = std::ref(map);
+        variant var_keys = std::ref(keys);
+        variant var_values = std::ref(values);
+        auto view = var.create_associative_view();
+
+        CHECK(view.insert(var_keys.create_sequential_view(), var_values.create_sequential_view()) == 2);
+        CHECK(map == std::map<int, std::string>({ { 1, "A" }, { 2, "B" }, { 3, "C" } }));
+    }
+
+    SECTION("std::multimap")
+    {
+        std::multimap<int, int> map;
+        std::vector<int> keys = { 1, 1, 2 };
+        std::vector<int> values = { 10, 11, 20 };
+        variant var = std::ref(map);
+        variant var_keys = std::ref(keys);
+        variant var_values = std::ref(values);
+        auto view = var.create_associative_view();
+
+        CHECK(view.insert(var_keys.create_sequential_view(), var_values.create_sequential_view()) == 3);
+        CHECK(map.count(1) == 2);
+    }
+
+    SECTION("key-only container")
+    {
+        std::unordered_set<int> set = { 1 };
+        std::vector<int> keys = { 3, 1, 2, 3 };
+        variant var = std::ref(set);
+        variant var_keys = std::ref(keys);
+        auto view = var.create_associative_view();
+
+        CHECK(view.insert(var_keys.create_sequential_view()) == 2);
+        CHECK(set == std::unordered_set<int>({ 1, 2, 3 }));
+
+        // values cannot be inserted into a key-only container
+        CHECK(view.insert(var_keys.create_sequential_view(), var_keys.create_sequential_view()) == 0);
+    }
+
+    SECTION("invalid input")
+    {
+        std::map<int, std::string> map;
+        std::vector<int> keys = { 1, 2 };
+        std::vector<double> wrong_keys = { 1.0, 2.0 };
+        std::vector<std::string> values = { "A" };
+        variant var = std::ref(map);
+        variant var_keys = std::ref(keys);
+        variant var_wrong_keys = std::ref(wrong_keys);
+        variant var_values = std::ref(values);
+        auto view = var.create_associative_view();
+
+        // different sizes
+        CHECK(view.insert(var_keys.create_sequential_view(), var_values.create_sequential_view()) == 0);
+        // only keys for a key-value container
+        CHECK(view.insert(var_keys.create_sequential_view()) == 0);
+
+        values.push_back("B");
+        CHECK(view.insert(var_wrong_keys.create_sequential_view(), var_values.create_sequential_view()) == 0);
+        CHECK(map.empty());
+    }
+
+    SECTION("const std::unordered_map")
+    {
+        const std::unordered_map<int, int> map;
+        std::vector<int> keys = { 1, 2 };
+        variant var = std::cref(map);
+        variant var_keys = std::ref(keys);
+        auto view = var.create_associative_view();
+
+        CHECK(view.insert(var_keys.create_sequential_view(), var_keys.create_sequential_view()) == 0);
+        CHECK(map.empty());
+    }
+
+    SECTION("from another associative view")
+    {
+        std::map<int, std::string> source = { { 1, "A" }, { 2, "B" }, { 3, "C" } };
+        std::unordered_map<int, std::string> map = { { 3, "X" } };
+        variant var_source = std::ref(source);
+        variant var = std::ref(map);
+        auto view = var.create_associative_view();
+
+        CHECK(view.insert(var_source.create_associative_view()) == 2);
+        CHECK(map == std::unordered_map<int, std::string>({ { 1, "A" }, { 2, "B" }, { 3, "X" } }));
+    }
+
+    SECTION("iterator range")
+    {
+        std::set<int> source = { 1, 2, 3, 4, 5 };
+        std::set<int> set;
+        variant var_source = std::ref(source);
+        variant var = std::ref(set);
+        auto view = var.create_associative_view();
+        auto view_source = var_source.create_associative_view();
+
+        CHECK(view.insert(view_source.begin() + 1, view_source.end() - 1) == 3);
+        CHECK(set == std::set<int>({ 2, 3, 4 }));
+    }
+
+    SECTION("into the same container")
+    {
+        std::unordered_multimap<int, std::string> map = { { 1, "A" }, { 2, "B" }, { 3, "C" } };
+        variant var = std::ref(map);
+        auto view = var.create_associative_view();
+
+        CHECK(view.insert(view) == 3);
+        CHECK(map.size() == 6);
+        CHECK(map.count(2) == 2);
+
+        std::unordered_set<int> set = { 1, 2, 3 };
+        variant var_set = std::ref(set);
+        auto view_set = var_set.create_associative_view();
+
+        CHECK(view_set.insert(view_set.begin(), view_set.end()) == 0);
+        CHECK(set == std::unordered_set<int>({ 1, 2, 3 }));
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant_associative_view::erase - batch", "[variant_associative_view]")
+{
+    std::unordered_map<int, std::string> map = { { 1, "A" }, { 2, "B" }, { 3, "C" }, { 4, "D" } };
+    std::list<int> keys = { 2, 3, 42 };
+    variant var = std::ref(map);
+    variant var_keys = std::ref(keys);
+    auto view = var.create_associative_view();
+
+    CHECK(view.erase(var_keys.create_sequential_view()) == 2);
+    CHECK(map == std::unordered_map<int, std::string>({ { 1, "A" }, { 4, "D" } }));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
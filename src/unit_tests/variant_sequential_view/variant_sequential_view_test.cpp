@@ -29,9 +29,14 @@
 
 #include <rttr/type>
 
+#include <array>
+#include <deque>
+#include <list>
 #include <vector>
 #include <map>
+#include <span>
 #include <string>
+#include <tuple>
 
 using namespace rttr;
 using namespace std;
@@ -924,3 +929,570 @@ TEST_CASE("variant_sequential_view::begin/end", "[variant_sequential_view]")
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant_sequential_view::get_contiguous_data()", "[variant_sequential_view]")
+{
+    SECTION("std::vector")
+    {
+        std::vector<float> vec = { 1.0f, 2.0f, 3.0f };
+        variant var = std::ref(vec);
+        auto view = var.create_sequential_view();
+
+        CHECK(view.is_contiguous() == true);
+
+        auto data = view.get_contiguous_data();
+        REQUIRE(data.is_valid() == true);
+        CHECK(static_cast<bool>(data) == true);
+        CHECK(data.get_data() == vec.data());
+        CHECK(data.get_size() == 3);
+        CHECK(data.get_stride() == sizeof(float));
+        CHECK(data.get_value_type() == type::get<float>());
+        CHECK(data.is_read_only() == false);
+
+        auto values = data.get_span<float>();
+        REQUIRE(values.size() == 3);
+        for (auto& value : values)
+            value *= 2.0f;
+
+        CHECK(vec[2] == 6.0f);
+        CHECK(data.get_span<const float>().size() == 3);
+        CHECK(data.get_span<int>().empty() == true);
+    }
+
+    SECTION("const std::vector")
+    {
+        const std::vector<int> vec = { 1, 2, 3 };
+        variant var = &vec;
+        auto data = var.create_sequential_view().get_contiguous_data();
+
+        REQUIRE(data.is_valid() == true);
+        CHECK(data.is_read_only() == true);
+        CHECK(data.get_span<int>().empty() == true);
+        REQUIRE(data.get_span<const int>().size() == 3);
+        CHECK(data.get_span<const int>()[1] == 2);
+    }
+
+    SECTION("std::array")
+    {
+        std::array<double, 4> obj = { 1.0, 2.0, 3.0, 4.0 };
+        variant var = std::ref(obj);
+        auto data = var.create_sequential_view().get_contiguous_data();
+
+        REQUIRE(data.is_valid() == true);
+        CHECK(data.get_data() == obj.data());
+        CHECK(data.get_size() == 4);
+        CHECK(data.get_value_type() == type::get<double>());
+        CHECK(data.get_span<double>()[3] == 4.0);
+    }
+
+    SECTION("raw array")
+    {
+        int obj[2][5] = { { 1, 2, 3, 4, 5}, { 6, 7, 8, 9, 10 } };
+        variant var = &obj;
+        auto data = var.create_sequential_view().get_contiguous_data();
+
+        REQUIRE(data.is_valid() == true);
+        CHECK(data.get_data() == &obj[0]);
+        CHECK(data.get_size() == 2);
+        CHECK(data.get_stride() == sizeof(int[5]));
+        CHECK(data.get_value_type() == type::get<int[5]>());
+        CHECK(data.get_span<int[5]>()[1][4] == 10);
+    }
+
+    SECTION("std::span")
+    {
+        std::vector<int> vec = { 1, 2, 3, 4 };
+        variant var = std::span<int>(vec.data() + 1, 2);
+        auto view = var.create_sequential_view();
+
+        CHECK(view.get_size() == 2);
+        CHECK(view.get_value(0).to_int() == 2);
+
+        auto data = view.get_contiguous_data();
+        REQUIRE(data.is_valid() == true);
+        CHECK(data.get_data() == vec.data() + 1);
+        CHECK(data.get_size() == 2);
+        CHECK(data.get_value_type() == type::get<int>());
+    }
+
+    SECTION("initializer_list")
+    {
+        auto list = { 1, 2, 3 };
+        variant var = list;
+        auto data = var.create_sequential_view().get_contiguous_data();
+
+        REQUIRE(data.is_valid() == true);
+        CHECK(data.is_read_only() == true);
+        CHECK(data.get_size() == 3);
+    }
+
+    SECTION("not contiguous")
+    {
+        variant var = std::list<int>({ 1, 2, 3 });
+        CHECK(var.create_sequential_view().is_contiguous() == false);
+        CHECK(var.create_sequential_view().get_contiguous_data().is_valid() == false);
+
+        var = std::deque<int>({ 1, 2, 3 });
+        CHECK(var.create_sequential_view().is_contiguous() == false);
+
+        var = std::vector<bool>({ true, false });
+        auto data = var.create_sequential_view().get_contiguous_data();
+        CHECK(data.is_valid() == false);
+        CHECK(data.get_span<bool>().empty() == true);
+    }
+
+    SECTION("invalid test")
+    {
+        variant var;
+        auto view = var.create_sequential_view();
+
+        CHECK(view.is_contiguous() == false);
+        CHECK(view.get_contiguous_data().get_data() == nullptr);
+        CHECK(view.get_contiguous_data().get_value_type().is_valid() == false);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename F, typename T>
+static void check_convert_equals_single_value_conversion()
+{
+    const std::vector<double> samples = { 0.0, 1.0, -1.0, 0.5, -0.5, 42.0, -128.0, 127.0, 255.0, 256.0,
+                                          32767.0, -32768.0, 65535.0, 2147483647.0, -2147483648.0,
+                                          4294967295.0, 1.0e10, -1.0e10, 1.0e20, 1.0e39 };
+    for (const auto sample : samples)
+    {
+        bool ok = false;
+        const F value = variant(sample).convert<F>(&ok);
+        if (!ok)
+            continue;
+
+        bool expected_ok = false;
+        const T expected = variant(value).convert<T>(&expected_ok);
+
+        std::vector<F> source(3, value);
+        std::vector<T> target;
+        variant var_source = std::ref(source);
+        variant var_target = std::ref(target);
+        const bool result = var_source.create_sequential_view().convert(var_target.create_sequential_view());
+
+        INFO(type::get<F>().get_name() << " -> " << type::get<T>().get_name() << ": " << sample);
+        CHECK(result == expected_ok);
+        if (result)
+        {
+            REQUIRE(target.size() == 3);
+            CHECK(target[2] == expected);
+        }
+    }
+}
+
+template<typename F, typename... T>
+static void check_convert_equals_single_value_conversion(std::tuple<T...>*)
+{
+    (check_convert_equals_single_value_conversion<F, T>(), ...);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant_sequential_view::convert()", "[variant_sequential_view]")
+{
+    SECTION("widening")
+    {
+        std::vector<int32_t> source = { 1, -2, 3 };
+        std::vector<double> target;
+        variant var_source = std::ref(source);
+        variant var_target = std::ref(target);
+
+        CHECK(var_source.create_sequential_view().convert(var_target.create_sequential_view()) == true);
+        CHECK(target == std::vector<double>({ 1.0, -2.0, 3.0 }));
+    }
+
+    SECTION("narrowing")
+    {
+        std::vector<int64_t> source = { 1, -128, 127 };
+        std::vector<int8_t> target = { 5 };
+        variant var_source = std::ref(source);
+        variant var_target = std::ref(target);
+
+        CHECK(var_source.create_sequential_view().convert(var_target.create_sequential_view()) == true);
+        CHECK(target == std::vector<int8_t>({ 1, -128, 127 }));
+
+        source.push_back(128);
+        CHECK(var_source.create_sequential_view().convert(var_target.create_sequential_view()) == false);
+        CHECK(target == std::vector<int8_t>({ 1, -128, 127 })); // target was not modified
+    }
+
+    SECTION("floating point")
+    {
+        std::vector<double> source = { 1.5, -2.5, 1.0e10 };
+        std::vector<float> target;
+        variant var_source = std::ref(source);
+        variant var_target = std::ref(target);
+
+        CHECK(var_source.create_sequential_view().convert(var_target.create_sequential_view()) == true);
+        CHECK(target == std::vector<float>({ 1.5f, -2.5f, 1.0e10f }));
+
+        std::vector<int32_t> int_target;
+        variant var_int_target = std::ref(int_target);
+        CHECK(var_source.create_sequential_view().convert(var_int_target.create_sequential_view()) == false);
+        CHECK(int_target.empty() == true);
+
+        source = { 1.0e40 };
+        CHECK(var_source.create_sequential_view().convert(var_target.create_sequential_view()) == false);
+    }
+
+    SECTION("static target")
+    {
+        std::vector<uint8_t> source = { 1, 2, 3 };
+        std::array<uint16_t, 3> target = { };
+        variant var_source = std::ref(source);
+        variant var_target = std::ref(target);
+
+        CHECK(var_source.create_sequential_view().convert(var_target.create_sequential_view()) == true);
+        CHECK(target == std::array<uint16_t, 3>({ 1, 2, 3 }));
+
+        source.push_back(4);
+        CHECK(var_source.create_sequential_view().convert(var_target.create_sequential_view()) == false);
+    }
+
+    SECTION("const target")
+    {
+        std::vector<int> source = { 1, 2, 3 };
+        const std::vector<double> target;
+        variant var_source = std::ref(source);
+        variant var_target = &target;
+
+        CHECK(var_source.create_sequential_view().convert(var_target.create_sequential_view()) == false);
+    }
+
+    SECTION("not contiguous")
+    {
+        std::list<int> source = { 1, 2, 3 };
+        std::vector<double> target;
+        variant var_source = std::ref(source);
+        variant var_target = std::ref(target);
+
+        CHECK(var_source.create_sequential_view().convert(var_target.create_sequential_view()) == true);
+        CHECK(target == std::vector<double>({ 1.0, 2.0, 3.0 }));
+
+        std::deque<std::string> string_target;
+        variant var_string_target = std::ref(string_target);
+        CHECK(var_source.create_sequential_view().convert(var_string_target.create_sequential_view()) == true);
+        CHECK(string_target == std::deque<std::string>({ "1", "2", "3" }));
+    }
+
+    SECTION("not contiguous - failed conversion")
+    {
+        std::list<std::string> source = { "4", "5", "no number" };
+        std::vector<int> target = { 1, 2 };
+        variant var_source = std::ref(source);
+        variant var_target = std::ref(target);
+
+        // the target is neither resized nor partially overwritten
+        CHECK(var_source.create_sequential_view().convert(var_target.create_sequential_view()) == false);
+        CHECK(target == std::vector<int>({ 1, 2 }));
+
+        std::deque<int> int_source = { 1, 300, 2 };
+        std::deque<uint8_t> deque_target = { 7 };
+        variant var_int_source = std::ref(int_source);
+        variant var_deque_target = std::ref(deque_target);
+
+        CHECK(var_int_source.create_sequential_view().convert(var_deque_target.create_sequential_view()) == false);
+        CHECK(deque_target == std::deque<uint8_t>({ 7 }));
+    }
+
+    SECTION("bool and char")
+    {
+        std::vector<int> source = { 0, 2, 65 };
+        std::vector<bool> bool_target;
+        std::vector<char> char_target;
+        variant var_source = std::ref(source);
+        variant var_bool_target = std::ref(bool_target);
+        variant var_char_target = std::ref(char_target);
+
+        CHECK(var_source.create_sequential_view().convert(var_bool_target.create_sequential_view()) == true);
+        CHECK(bool_target == std::vector<bool>({ false, true, true }));
+
+        CHECK(var_source.create_sequential_view().convert(var_char_target.create_sequential_view()) == true);
+        CHECK(char_target == std::vector<char>({ 0, 2, 'A' }));
+    }
+
+    SECTION("same result as single value conversion")
+    {
+        using number_types = std::tuple<bool, char, int8_t, int16_t, int32_t, int64_t,
+                                        uint8_t, uint16_t, uint32_t, uint64_t, float, double>;
+        check_convert_equals_single_value_conversion<bool>(static_cast<number_types*>(nullptr));
+        check_convert_equals_single_value_conversion<char>(static_cast<number_types*>(nullptr));
+        check_convert_equals_single_value_conversion<int8_t>(static_cast<number_types*>(nullptr));
+        check_convert_equals_single_value_conversion<int16_t>(static_cast<number_types*>(nullptr));
+        check_convert_equals_single_value_conversion<int32_t>(static_cast<number_types*>(nullptr));
+        check_convert_equals_single_value_conversion<int64_t>(static_cast<number_types*>(nullptr));
+        check_convert_equals_single_value_conversion<uint8_t>(static_cast<number_types*>(nullptr));
+        check_convert_equals_single_value_conversion<uint16_t>(static_cast<number_types*>(nullptr));
+        check_convert_equals_single_value_conversion<uint32_t>(static_cast<number_types*>(nullptr));
+        check_convert_equals_single_value_conversion<uint64_t>(static_cast<number_types*>(nullptr));
+        check_convert_equals_single_value_conversion<float>(static_cast<number_types*>(nullptr));
+        check_convert_equals_single_value_conversion<double>(static_cast<number_types*>(nullptr));
+    }
+
+    SECTION("invalid test")
+    {
+        std::vector<int> source = { 1, 2, 3 };
+        variant var_source = std::ref(source);
+        variant var_target;
+
+        CHECK(var_source.create_sequential_view().convert(var_target.create_sequential_view()) == false);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant_sequential_view::reserve()", "[variant_sequential_view]")
+{
+    SECTION("std::vector")
+    {
+        std::vector<int> vec = { 1, 2, 3 };
+        variant var = std::ref(vec);
+        auto view = var.create_sequential_view();
+
+        CHECK(view.reserve(100) == true);
+        CHECK(vec.capacity() >= 100);
+        CHECK(view.get_size() == 3);
+    }
+
+    SECTION("std::list")
+    {
+        std::list<int> list = { 1, 2, 3 };
+        variant var = std::ref(list);
+        auto view = var.create_sequential_view();
+
+        CHECK(view.reserve(100) == false);
+        CHECK(view.get_size() == 3);
+    }
+
+    SECTION("const std::vector")
+    {
+        const std::vector<int> vec = { 1, 2, 3 };
+        variant var = std::cref(vec);
+        auto view = var.create_sequential_view();
+
+        CHECK(view.reserve(100) == false);
+        CHECK(vec.capacity() < 100);
+    }
+
+    SECTION("static array")
+    {
+        int array[3] = { 1, 2, 3 };
+        variant var = std::ref(array);
+        auto view = var.create_sequential_view();
+
+        CHECK(view.reserve(100) == false);
+    }
+
+    SECTION("invalid")
+    {
+        variant var;
+        auto view = var.create_sequential_view();
+
+        CHECK(view.reserve(100) == false);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant_sequential_view::insert() - range", "[variant_sequential_view]")
+{
+    SECTION("contiguous values")
+    {
+        std::vector<int> vec = { 1, 5 };
+        std::array<int, 3> values = { 2, 3, 4 };
+        variant var = std::ref(vec);
+        variant var_values = std::ref(values);
+        auto view = var.create_sequential_view();
+
+        auto itr = view.insert(view.begin() + 1, var_values.create_sequential_view());
+
+        REQUIRE(itr != view.end());
+        CHECK(itr.get_data().to_int() == 2);
+        CHECK(vec == std::vector<int>({ 1, 2, 3, 4, 5 }));
+    }
+
+    SECTION("non-contiguous values")
+    {
+        std::deque<int> deque = { 1, 5 };
+        std::list<int> values = { 2, 3, 4 };
+        variant var = std::ref(deque);
+        variant var_values = std::ref(values);
+        auto view = var.create_sequential_view();
+
+        auto itr = view.insert(view.begin() + 1, var_values.create_sequential_view());
+
+        REQUIRE(itr != view.end());
+        CHECK(itr.get_data().to_int() == 2);
+        CHECK(deque == std::deque<int>({ 1, 2, 3, 4, 5 }));
+    }
+
+    SECTION("insert at the end")
+    {
+        std::vector<std::string> vec = { "A" };
+        std::list<std::string> values = { "B", "C" };
+        variant var = std::ref(vec);
+        variant var_values = std::ref(values);
+        auto view = var.create_sequential_view();
+
+        auto itr = view.insert(view.end(), var_values.create_sequential_view());
+
+        REQUIRE(itr != view.end());
+        CHECK(itr.get_data().to_string() == "B");
+        CHECK(vec == std::vector<std::string>({ "A", "B", "C" }));
+    }
+
+    SECTION("iterator range")
+    {
+        std::vector<int> vec = { 1, 5 };
+        std::vector<int> values = { 0, 2, 3, 4, 9 };
+        variant var = std::ref(vec);
+        variant var_values = std::ref(values);
+        auto view = var.create_sequential_view();
+        auto view_values = var_values.create_sequential_view();
+
+        auto itr = view.insert(view.begin() + 1, view_values.begin() + 1, view_values.end() - 1);
+
+        REQUIRE(itr != view.end());
+        CHECK(itr.get_data().to_int() == 2);
+        CHECK(vec == std::vector<int>({ 1, 2, 3, 4, 5 }));
+    }
+
+    SECTION("values of the same container")
+    {
+        std::vector<std::string> vec = { "A", "B", "C" };
+        vec.shrink_to_fit();
+        variant var = std::ref(vec);
+        auto view = var.create_sequential_view();
+
+        // the insertion reallocates the storage of the values
+        auto itr = view.insert(view.end(), view);
+
+        REQUIRE(itr != view.end());
+        CHECK(itr.get_data().to_string() == "A");
+        CHECK(vec == std::vector<std::string>({ "A", "B", "C", "A", "B", "C" }));
+    }
+
+    SECTION("iterator range of the same container")
+    {
+        std::vector<int> vec = { 1, 2, 3 };
+        vec.shrink_to_fit();
+        variant var = std::ref(vec);
+        auto view = var.create_sequential_view();
+
+        auto itr = view.insert(view.begin() + 1, view.begin(), view.end());
+
+        REQUIRE(itr != view.end());
+        CHECK(itr.get_data().to_int() == 1);
+        CHECK(vec == std::vector<int>({ 1, 1, 2, 3, 2, 3 }));
+    }
+
+    SECTION("empty range")
+    {
+        std::vector<int> vec = { 1, 2 };
+        std::vector<int> values;
+        variant var = std::ref(vec);
+        variant var_values = std::ref(values);
+        auto view = var.create_sequential_view();
+
+        auto itr = view.insert(view.begin() + 1, var_values.create_sequential_view());
+
+        REQUIRE(itr != view.end());
+        CHECK(itr.get_data().to_int() == 2);
+        CHECK(vec.size() == 2);
+    }
+
+    SECTION("different value type")
+    {
+        std::vector<int> vec = { 1, 2 };
+        std::vector<double> values = { 3.0, 4.0 };
+        variant var = std::ref(vec);
+        variant var_values = std::ref(values);
+        auto view = var.create_sequential_view();
+
+        auto itr = view.insert(view.end(), var_values.create_sequential_view());
+
+        CHECK(itr == view.end());
+        CHECK(vec == std::vector<int>({ 1, 2 }));
+    }
+
+    SECTION("const std::vector")
+    {
+        const std::vector<int> vec = { 1, 2 };
+        std::vector<int> values = { 3, 4 };
+        variant var = std::cref(vec);
+        variant var_values = std::ref(values);
+        auto view = var.create_sequential_view();
+
+        auto itr = view.insert(view.end(), var_values.create_sequential_view());
+
+        CHECK(itr == view.end());
+        CHECK(vec == std::vector<int>({ 1, 2 }));
+    }
+
+    SECTION("static array")
+    {
+        int array[2] = { 1, 2 };
+        std::vector<int> values = { 3, 4 };
+        variant var = std::ref(array);
+        variant var_values = std::ref(values);
+        auto view = var.create_sequential_view();
+
+        auto itr = view.insert(view.begin(), var_values.create_sequential_view());
+
+        CHECK(itr == view.end());
+        CHECK(array[0] == 1);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant_sequential_view::erase() - range", "[variant_sequential_view]")
+{
+    SECTION("std::vector")
+    {
+        std::vector<int> vec = { 1, 2, 3, 4, 5 };
+        variant var = std::ref(vec);
+        auto view = var.create_sequential_view();
+
+        auto itr = view.erase(view.begin() + 1, view.begin() + 4);
+
+        REQUIRE(itr != view.end());
+        CHECK(itr.get_data().to_int() == 5);
+        CHECK(vec == std::vector<int>({ 1, 5 }));
+    }
+
+    SECTION("std::list")
+    {
+        std::list<int> list = { 1, 2, 3, 4, 5 };
+        variant var = std::ref(list);
+        auto view = var.create_sequential_view();
+
+        auto itr = view.erase(view.begin(), view.end() - 1);
+
+        REQUIRE(itr != view.end());
+        CHECK(itr.get_data().to_int() == 5);
+        CHECK(list == std::list<int>({ 5 }));
+    }
+
+    SECTION("const std::vector")
+    {
+        const std::vector<int> vec = { 1, 2, 3 };
+        variant var = std::cref(vec);
+        auto view = var.create_sequential_view();
+
+        auto itr = view.erase(view.begin(), view.end());
+
+        CHECK(itr == view.end());
+        CHECK(vec.size() == 3);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////